@@ -37,6 +37,7 @@ update_armor_class()
 	if (ISRING(LEFT, R_PROTECT)) ac -= cur_ring[LEFT]->o_ac;
 	if (ISRING(RIGHT, R_PROTECT)) ac -= cur_ring[RIGHT]->o_ac;
 	pstats.s_arm = ac;
+	power_reset();
 }
 
 /*
@@ -11,29 +11,40 @@
 
 coord ch_ret;			/* Where chasing takes	you */
 
+static void	claim(THING *tp, THING *obj);
+
 /*
  * runners:
  *	Make all the running monsters move.
  */
 void
-runners()
+runners(void *arg)
 {
 	register THING *tp;
-	register int dist;
-
-	for	(tp = mlist; tp	!= NULL; tp = next(tp)) {
-		if (!on(*tp, ISHELD) && on(*tp, ISRUN)) {
-			dist = DISTANCE(hero.y, hero.x, tp->t_pos.y, tp->t_pos.x);
-			if	(!(on(*tp, ISSLOW) || (tp->t_type == 'S' && dist > 3)) || tp->t_turn)
-				do_chase(tp);
-			if (on(*tp, ISHASTE))
-				do_chase(tp);
-			dist = DISTANCE(hero.y, hero.x, tp->t_pos.y, tp->t_pos.x);
-			if (on(*tp, ISFLY) && dist > 3)
-				do_chase(tp);
-			tp->t_turn ^= TRUE;
-		}
+	register int slot;
+	long until;
+
+	(void) arg;	//@ no payload
+
+	/*
+	 * Only the active runners are in the queue, so sleeping monsters
+	 * cost nothing here.  Every one whose next action comes before the
+	 * hero's next one takes it, in time order, and is queued again at
+	 * its own pace (see sched_delay()).  Rows stay put during the
+	 * sweep, so a monster that died during its own move is noticed by
+	 * its row; one that stopped running was already dropped by
+	 * mt_sync().
+	 */
+	until = sched_hero();
+	mt_begin();
+	while ((tp = sched_next(until)) != NULL) {
+		slot = tp->t_slot;
+		do_chase(tp);
+		if (mtab.mt_thing[slot] == tp
+		  && (mtab.mt_flags[slot] & (ISHELD|ISRUN)) == ISRUN)
+			sched_add(tp);
 	}
+	mt_end();
 }
 
 /*
@@ -50,13 +61,16 @@ THING *th;
 	struct room	*oroom;
 	register struct room	*rer, *ree;	/* room of chaser, room of chasee */
 	coord this;				/* Temporary	destination for	chaser */
+	coord *dest;				/* Where its target is */
+	coord from;				/* Where it moved from */
 
-	rer	= th->t_room;		/* Find room of chaser */
+	rer	= ROOM_AT(th->t_room);	/* Find room of chaser */
 	if (on(*th,	ISGREED) && rer->r_goldval == 0)
-		th->t_dest = &hero;	/*	If gold	has been taken,	run after hero */
+		dest_hero(th);	/*	If gold	has been taken,	run after hero */
+	dest = dest_pos(th);
 	ree	= proom;
-	if (th->t_dest != &hero)	/*	Find room of chasee */
-		ree = roomin(th->t_dest);
+	if (th->t_dest.tg_kind != TG_HERO)	/*	Find room of chasee */
+		ree = roomin(dest);
 	if (ree == NULL)
 		return;
 	/*
@@ -74,7 +88,7 @@ over:
 	if (rer != ree && (rer->r_flags & ISMAZE) == 0)
 	{
 		for (i	= 0; i < rer->r_nexits;	i++) {	/*	loop through doors */
-			dist = DISTANCE(th->t_dest->y, th->t_dest->x,rer->r_exit[i].y, rer->r_exit[i].x);
+			dist = DISTANCE(dest->y, dest->x,rer->r_exit[i].y, rer->r_exit[i].x);
 			if	(dist <	mindist) {
 				this = rer->r_exit[i];
 				mindist = dist;
@@ -86,7 +100,7 @@ over:
 			goto over;
 		}
 	} else {
-		this =	*th->t_dest;
+		this =	*dest;
 		/*
 		 * For	monsters which can fire	bolts at the poor hero,	we check to
 		 * see	if (a) the hero	in on a	straight line from it, and (b) that
@@ -115,66 +129,79 @@ over:
 	if (ce(ch_ret, hero)) {
 		attack(th);
 		return;
-	} else if (ce(ch_ret,	*th->t_dest)) {
-		for (obj = lvl_obj; obj != NULL; obj =	next(obj))
-			if	(th->t_dest == &obj->o_pos) {
-				byte oldchar;
-
-				detach(lvl_obj, obj);
-				attach(th->t_pack, obj);
-				oldchar = chat(obj->o_pos.y, obj->o_pos.x) =
-				(th->t_room->r_flags & ISGONE) ? PASSAGE : FLOOR;
-				if (cansee(obj->o_pos.y, obj->o_pos.x))
-					mvaddch(obj->o_pos.y, obj->o_pos.x, oldchar);
-				th->t_dest = find_dest(th);
-				break;
-			}
+	} else if (ce(ch_ret,	*dest)) {
+		/*
+		 * An object it's after is the one it has claimed
+		 */
+		if (th->t_dest.tg_kind == TG_OBJECT
+		  && (obj = t_handle(th->t_dest.tg_id, th->t_dest.tg_gen)) != NULL) {
+			byte oldchar;
+
+			detach(lvl_obj, obj);
+			attach(th->t_pack, obj);
+			if (EV_ON(EV_PICKED))
+				ev_picked(th, obj);
+			oldchar = chat(obj->o_pos.y, obj->o_pos.x) =
+			(ROOM_AT(th->t_room)->r_flags & ISGONE) ? PASSAGE : FLOOR;
+			if (cansee(obj->o_pos.y, obj->o_pos.x) && EV_ON(EV_TILE))
+				ev_tile(obj->o_pos.y, obj->o_pos.x, oldchar, NULL, FALSE);
+			find_dest(th);
+		}
 	}
 	if (th->t_type == 'F')
 		return;
 	/*
-	 * If the chasing thing moved, update the screen
+	 * If the chasing thing moved, update the screen.  @ That is left to
+	 * whoever takes EV_TILE, so nothing is drawn with no screen
 	 */
-	if (th->t_oldch != '@') {
-		if	(th->t_oldch ==	' ' && cansee(th->t_pos.y, th->t_pos.x)
+	if (th->t_oldch != '@' && EV_ON(EV_TILE)) {
+		byte ch = th->t_oldch;
+
+		if	(ch == ' ' && cansee(th->t_pos.y, th->t_pos.x)
 			   && _level[INDEX(th->t_pos.y,th->t_pos.x)] == FLOOR)
-			mvaddch(th->t_pos.y, th->t_pos.x, FLOOR);
-		else if (th->t_oldch == FLOOR && !cansee(th->t_pos.y, th->t_pos.x)
+			ch = FLOOR;
+		else if (ch == FLOOR && !cansee(th->t_pos.y, th->t_pos.x)
 				&& !on(player, SEEMONST))
-			mvaddch(th->t_pos.y, th->t_pos.x, ' ');
-		else
-			mvaddch(th->t_pos.y, th->t_pos.x, th->t_oldch);
+			ch = ' ';
+		ev_tile(th->t_pos.y, th->t_pos.x, ch, NULL, FALSE);
 	}
-	oroom = th->t_room;
+	oroom = ROOM_AT(th->t_room);
 	if (!ce(ch_ret, th->t_pos))
 	{
-		if ((th->t_room = roomin(&ch_ret)) == NULL) {
-			th->t_room	= oroom;
+		if ((rer = roomin(&ch_ret)) == NULL)
 			return;
-		}
-		if (oroom != th->t_room)
-			th->t_dest	= find_dest(th);
+		th->t_room = room_id(rer);
+		if (oroom != rer)
+			find_dest(th);
+		from = th->t_pos;
 		th->t_pos = ch_ret;
+		mt_sync(th);
+		if (EV_ON(EV_MOVED))
+			ev_moved(th, &from);
 	}
 
+	/*
+	 * What it stands on comes off the level, not the screen: a square
+	 * the hero can't see shows him nothing
+	 */
 	if (see_monst(th)) {
-		if (flat(ch_ret.y,ch_ret.x) & F_PASS)
-			standout();
-		th->t_oldch = mvinch(ch_ret.y, ch_ret.x);
-		mvaddch(ch_ret.y, ch_ret.x, th->t_disguise);
+		th->t_oldch = chat(ch_ret.y, ch_ret.x);
+		if (EV_ON(EV_TILE))
+			ev_tile(ch_ret.y, ch_ret.x, th->t_disguise, th,
+				(flat(ch_ret.y,ch_ret.x) & F_PASS) != 0);
 	}
 	else if (on(player,	SEEMONST))
 	{
-		standout();
-		th->t_oldch = mvinch(ch_ret.y, ch_ret.x);
-		mvaddch(ch_ret.y, ch_ret.x, th->t_type);
+		th->t_oldch = cansee(ch_ret.y, ch_ret.x) ?
+			chat(ch_ret.y, ch_ret.x) : ' ';
+		if (EV_ON(EV_TILE))
+			ev_tile(ch_ret.y, ch_ret.x, th->t_type, th, TRUE);
 	}
 	else
 		th->t_oldch = '@';
 
 	if (th->t_oldch == FLOOR && (oroom->r_flags & ISDARK))
 		th->t_oldch = ' ';
-	standend();
 }
 
 /*
@@ -189,9 +216,14 @@ register THING *mp;
 		return	FALSE;
 	if (on(*mp,	ISINVIS) && !on(player,	CANSEE))
 		return	FALSE;
-	if (DISTANCE(mp->t_pos.y, mp->t_pos.x, hero.y, hero.x) >= LAMPDIST &&
-	  ((mp->t_room != proom || (mp->t_room->r_flags & ISDARK) ||
-	  (mp->t_room->r_flags & ISMAZE))))
+	if (!fov_see(mp->t_pos.y, mp->t_pos.x))
+		return FALSE;
+	/*@
+	 * In a maze the hero sees down the passages, but monsters only
+	 * by his lamp, as they always have been
+	 */
+	if (proom != NULL && (proom->r_flags & ISMAZE)
+	  && DISTANCE(mp->t_pos.y, mp->t_pos.x, hero.y, hero.x) >= LAMPDIST)
 		return FALSE;
 	/*
 	 * If we are seeing	the enemy of a vorpally	enchanted weapon for the first
@@ -227,7 +259,8 @@ register coord *runner;
 		 */
 		tp->t_flags |= ISRUN;
 		tp->t_flags &= ~ISHELD;
-		tp->t_dest	= find_dest(tp);
+		mt_sync(tp);
+		find_dest(tp);
 	}
 #ifdef DEBUG
 	else
@@ -272,8 +305,10 @@ coord *ee;
 		/*
 		 * Small chance that it will become un-confused
 		 */
-		if (rnd(30) ==	17)
+		if (rnd(30) ==	17) {
 			tp->t_flags &= ~ISHUH;
+			mt_sync(tp);
+		}
 	}
 	/*
 	 * Otherwise, find the empty spot next to the chaser that is
@@ -387,28 +422,20 @@ bool
 cansee(y, x)
 register int y,	x;
 {
-	register struct room *rer;
-	coord tp;
-
-	if (on(player, ISBLIND))
-		return	FALSE;
-	if (DISTANCE(y, x, hero.y, hero.x) < LAMPDIST)
-		return	TRUE;
 	/*
 	 * We can only see if the hero in the same room as
 	 * the coordinate and the room is lit or if	it is close.
+	 * @ fov.c works that out once per move, this is a bit lookup
 	 */
-	tp.y = y;
-	tp.x = x;
-	rer	= roomin(&tp);
-	return (rer	== proom && !(rer->r_flags & ISDARK));
+	return fov_see(y, x);
 }
 
 /*
  * find_dest:
- *	find	the proper destination for the monster
+ *	find	the proper destination for the monster.  An object it goes
+ *	after is claimed, so no other monster goes after it too.
  */
-coord *
+void
 find_dest(tp)
 register THING *tp;
 {
@@ -416,22 +443,114 @@ register THING *tp;
 	register int prob;
 	register struct room *rp;
 
-	if ((prob =	monsters[tp->t_type - 'A'].m_carry) <= 0 || tp->t_room == proom
+	if ((prob =	monsters[tp->t_type - 'A'].m_carry) <= 0 || ROOM_AT(tp->t_room) == proom
 	|| see_monst(tp))
-		return &hero;
-	rp = tp->t_room;
+	{
+		claim(tp, NULL);
+		return;
+	}
+	rp = ROOM_AT(tp->t_room);
 	for	(obj = lvl_obj;	obj != NULL; obj = next(obj))
 	{
 	if (obj->o_type == SCROLL && obj->o_which == S_SCARE)
 		continue;
-	if (roomin(&obj->o_pos) == rp && rnd(100) < prob)
+	if (roomin(&obj->o_pos) == rp && rnd(100) < prob && obj->o_claim == NULL)
 	{
-		for (tp = mlist; tp != NULL; tp = next(tp))
-		if (tp->t_dest == &obj->o_pos)
-			break;
-		if	(tp == NULL)
-		return &obj->o_pos;
+		claim(tp, obj);
+		return;
 	}
 	}
+	claim(tp, NULL);
+}
+
+/*
+ * claim:
+ *	Send a monster after an object, which it claims, or after the
+ *	hero if obj is NULL, dropping whatever it had claimed before
+ */
+static
+void
+claim(THING *tp, THING *obj)
+{
+	register struct target *tg;
+	register THING *old;
+
+	tg = &tp->t_dest;
+	if (tg->tg_kind == TG_OBJECT
+	  && (old = t_handle(tg->tg_id, tg->tg_gen)) != NULL)
+		old->o_claim = NULL;
+	if (obj == NULL)
+	{
+		tg->tg_kind = TG_HERO;
+		return;
+	}
+	tg->tg_kind = TG_OBJECT;
+	tg->tg_id = obj->l_id;
+	tg->tg_gen = t_gen(obj);
+	obj->o_claim = tp;
+}
+
+/*
+ * dest_hero:
+ *	Send a monster after the hero.  This also lets go of the object it
+ *	was after, so it's called for a monster that is gone, too.
+ */
+void
+dest_hero(THING *tp)
+{
+	claim(tp, NULL);
+}
+
+/*
+ * dest_gold:
+ *	Send a monster to guard the gold of a room
+ */
+void
+dest_gold(THING *tp, struct room *rp)
+{
+	claim(tp, NULL);
+	tp->t_dest.tg_kind = TG_GOLD;
+	tp->t_dest.tg_room = room_id(rp);
+}
+
+/*
+ * dest_pos:
+ *	Where the target of a monster is now.  If the object it was after
+ *	has gone without telling it, it turns on the hero.
+ */
+coord *
+dest_pos(THING *tp)
+{
+	register struct target *tg;
+	register THING *obj;
+
+	tg = &tp->t_dest;
+	switch (tg->tg_kind)
+	{
+	when TG_OBJECT:
+		if ((obj = t_handle(tg->tg_id, tg->tg_gen)) != NULL)
+			return &obj->o_pos;
+		tg->tg_kind = TG_HERO;
+	when TG_GOLD:
+		return &ROOM_AT(tg->tg_room)->r_gold;
+	when TG_COORD:
+		return &tg->tg_pos;
+	}
 	return &hero;
 }
+
+/*
+ * obj_unclaim:
+ *	An object is leaving the floor.  The monster that was after it
+ *	gets mad and runs at the hero.
+ */
+void
+obj_unclaim(THING *obj)
+{
+	register THING *tp;
+
+	if ((tp = obj->o_claim) == NULL)
+		return;
+	dest_hero(tp);
+	obj->o_claim = NULL;
+}
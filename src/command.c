@@ -15,42 +15,42 @@ command()
 {
 	register int ntimes;
 
-	if (on(player, ISHASTE))
-		ntimes = rnd(2) + 2;
-	else
-		ntimes = 1;
-	while (ntimes--) {
-		status();
+	/*
+	 * One action of the hero.  A hasted hero gets his extra actions
+	 * from the scheduler, which holds the monsters back meanwhile.
+	 */
+	status();
 #ifdef WIZARD
-		if (wizard)
-			noscore = TRUE;
+	if (wizard)
+		noscore = TRUE;
 #endif
-		if (no_command) {
-			if (--no_command <= 0) {
-				msg("you can move again");
-				no_command = 0;
-			}
-			cur_refresh();  //@ sleeping, fainted, frozen, etc
-		} else
-			execcom();
-		do_fuses();
-		do_daemons();
-		for (ntimes = LEFT; ntimes <= RIGHT; ntimes++)
+	if (no_command) {
+		if (--no_command <= 0) {
+			msg("you can move again");
+			no_command = 0;
+		}
+		show_frame(FALSE);  //@ sleeping, fainted, frozen, etc
+	} else
+		execcom();
+	do_fuses();
+	do_daemons();
+	for (ntimes = LEFT; ntimes <= RIGHT; ntimes++)
+	{
+		if (cur_ring[ntimes])
 		{
-			if (cur_ring[ntimes])
+			switch (cur_ring[ntimes]->o_which)
 			{
-				switch (cur_ring[ntimes]->o_which)
-				{
-				when R_SEARCH:
-					search();
-				when R_TELEPORT:
-					if (rnd(50) == 17)
-						teleport();
-					break;
-				}
+			when R_SEARCH:
+				search();
+			when R_TELEPORT:
+				if (rnd(50) == 17)
+					teleport();
+				break;
 			}
 		}
 	}
+	ev_flush();
+	link_turn();
 }
 
 //@ No need to declare in rogue.h
@@ -99,13 +99,13 @@ get_prefix()
 		do_take = lasttake;
 		retch = lastch;
 		fastmode = FALSE;
-		cur_refresh();  //@ repeated commands, ie, "10s"
+		show_frame(FALSE);  //@ repeated commands, ie, "10s"
 	} else {
 		count = 0;
 		if (running) {
 			retch = runch;
 			do_take = lasttake;
-			cur_refresh();  //@ running ("H", "fh", "L", etc)
+			show_frame(FALSE);  //@ running ("H", "fh", "L", etc)
 		} else {
 			for (retch = 0; retch == 0; ) {
 				switch (ch = com_char()) {
@@ -237,7 +237,7 @@ execcom()
 				addmsg("(%d)",csum());
 			msg("Rogue version %d.%d (Mr. Mctesq was here)", revno, verno);
 		when 'S': after = FALSE; save_game();
-		when '.': doctor();
+		when '.': doctor(NULL);
 		when '^':
 			after = FALSE;
 			if (get_dir()) {
@@ -259,6 +259,12 @@ execcom()
 			msg("the screen looks fine to me (jll was here)");
 #ifdef WIZARD
 		when 'C': after = FALSE; create_obj();
+		when CTRL('A'):
+			after = FALSE;
+			msg("things: %d in use, %d on the level, %d at most, %d in the pool",
+				total, _arena[A_LEVEL].a_inuse, maxitems,
+				(_arena[A_GAME].a_nblk + _arena[A_LEVEL].a_nblk) * THINGBLK);
+		when CTRL('P'): after = FALSE; d_report();
 #endif
 		when CTRL('B'): after = FALSE; {
 			THING *tp = new_item();
@@ -270,12 +276,7 @@ execcom()
 				cp.x = hero.x;
 			}
 			new_monster(tp, randmonster(TRUE), &cp);
-			tp->t_rarity = LEGENDARY;
-			tp->t_stats.s_maxhp *= 3;
-			tp->t_stats.s_hpt = tp->t_stats.s_maxhp;
-			tp->t_stats.s_str += 5;
-			tp->t_stats.s_exp *= 5;
-			tp->t_flags |= ISMEAN;
+			legendary(tp);
 			msg("A legendary boss appears!");
 		}
 		when CTRL('I'): after = FALSE; {
@@ -90,6 +90,13 @@ bool change_colors = TRUE;
 bool use_terminal_fgbg = TRUE;
 #endif
 
+/*@
+ * Slow link mode, for players on a remote terminal where every byte sent
+ * counts: plain ASCII chars and no cosmetic redraws, and the bytes sent each
+ * turn are counted, see link_turn(). Set from env file "link", see main.c
+ */
+bool slow_link = FALSE;
+
 //@ unused
 int tab_size = 8;
 
@@ -114,8 +121,52 @@ static int	KEY_MASK;
 static wchar_t	ccunicode[2] = L" ";  // temp buffer
 static CCODE	ccode = {'\0', ccunicode, '\0'};  // temp charcode
 static bool	colors_changed = FALSE;  // if colors palette was redefined
+
+/*@
+ * The screen as the game drew it, in DOS chars and attributes, the way the
+ * video memory held it. cur_inch() reads it back from here, so the game
+ * never asks curses what is on screen and never has to undo the charset
+ * translation, and it reads the same with no curses screen at all, as in
+ * graphics mode. Everything that draws keeps it up to date, and sh_row,
+ * sh_col follow the cursor just like curses does.
+ */
+typedef struct {
+	byte	sh_ch;
+	byte	sh_attr;
+} SHCELL;
+
+static SHCELL	shadow[MAXLINES][MAXCOLS];
+static SHCELL	shsave[MAXLINES][MAXCOLS];  // shadow of savewin
+static int	sh_row, sh_col;
+
+static SHCELL	*sh_cell(int r, int c);
+static void	sh_fill(int r, int c, int n, byte chd, byte attr);
+static void	sh_clear(void);
+static void	sh_wrap(void);
+
+/*@
+ * What cur_addch() puts on screen, one row of 256 for each DOS attribute it
+ * is called with: the attribute each DOS char is really shown with (see
+ * glyph_attr()) and its curses cell, all ready, so putting a char is a
+ * lookup and a store. A row is built by cell_row() on first use, for the
+ * charset and colors in use, and init_curses_colors() throws them away.
+ */
+typedef struct {
+	byte	cr_attr[256];
+	chtype	cr_ch[256];		// ASCII and CP437
+#ifdef ROGUE_WIDECHAR
+	cchar_t	cr_wch[256];		// UNICODE
+#endif
+} CELLROW;
+
+static CELLROW	*cell_rows[256];
+
+static CELLROW	*cell_row(byte dos_attr);
+static void	cell_free(void);
 #endif  // ROGUE_DOS_CURSES
 
+static byte	glyph_attr(byte dos_attr, byte chr);
+
 /*@
  * "it's complicated" - extern'ed but should probably be static and have an API
  * savewin is used in game save/restore, and I'm still not sure if exposing it
@@ -197,9 +248,9 @@ static byte *at_table;
  */
 static CCODE ctab[] = {
 		/*
-		 * Dungeon chars. If a char in this block is not unique, such as
-		 * the ASCII for room corners, cur_inch() reverse search will map
-		 * them back to a different DOS char. So choose them carefully.
+		 * Dungeon chars. They need not be unique, such as the ASCII
+		 * for room corners: cur_inch() reads the DOS char back from
+		 * the shadow screen, not from what is shown.
 		 */
 		{'@', L"\x263A", PLAYER},     // ☺
 		{'^', L"\x2666", TRAP},       // ♦
@@ -268,6 +319,7 @@ static CCODE btab[] = {
 		{'\0', L"", 0}
 };
 
+
 /*@
  * Numpad keys missing from the terminfo data of some common terminals
  * See define_keys()
@@ -557,6 +609,8 @@ cur_move(row, col)
 #else
 	graphics_cursor_row = row;
 	graphics_cursor_col = col;
+	sh_row = row;
+	sh_col = col;
 	return wmove(stdscr, row, col);
 #endif
 }
@@ -647,6 +701,8 @@ putchr(byte ch)
  * the mvinch() wrapper, are preceded by a move().
  *
  * This function replicates this behavior, except the redundant move.
+ * With <curses.h> the char comes from the shadow screen, already in DOS
+ * terms, instead of being read back from curses. See shadow[].
  *
  * BIOS INT 10h/AH=08h - Read character and attribute at cursor position
  * BH = page number
@@ -673,51 +729,87 @@ cur_inch(void)
 	}
 	return (byte)LOW(chrattr);
 #else
-	byte chd = 0;
-	CCODE *ccp;
-	wchar_t wch;  // character on screen
-	wchar_t wcr;  // reference character on ctab mapping
-#ifdef ROGUE_WIDECHAR
-	cchar_t cch;
-	wchar_t wcha[CCHARW_MAX + 1];
-	attr_t dummya;
-	short dummyc;
-
-	win_wch(stdscr, &cch);
-	getcchar(&cch, wcha, &dummya, &dummyc, NULL);
-	wch = wcha[0];
-#else
+	register SHCELL *sp;
 
-	wch = (wchar_t)(A_CHARTEXT & winch(stdscr));
-#endif  // ROGUE_WIDECHAR
-	// if not on mapping list, will report as itself
-	chd = (byte)wch;
+	if ((sp = sh_cell(sh_row, sh_col)) == NULL)
+		return ' ';
+	return sp->sh_ch;
+#endif  // ROGUE_DOS_CURSES
+}
+
+
+#ifndef ROGUE_DOS_CURSES
+/*@
+ * The shadow screen cell at r, c, or NULL if it's off the game screen
+ */
+static
+SHCELL *
+sh_cell(int r, int c)
+{
+	if (r < 0 || r >= MAXLINES || c < 0 || c >= MAXCOLS)
+		return NULL;
+	return &shadow[r][c];
+}
+
+/*@
+ * Set n shadow screen cells from r, c rightwards, as far as the line goes
+ */
+static
+void
+sh_fill(int r, int c, int n, byte chd, byte attr)
+{
+	register SHCELL *sp;
 
-	if (charset == CP437)
+	if (r < 0 || r >= MAXLINES)
+		return;
+	if (c < 0)
 	{
-		return chd;
+		n += c;
+		c = 0;
 	}
-	for(ccp = ctab; ccp->dos; ccp++)
+	if (n > MAXCOLS - c)
+		n = MAXCOLS - c;
+	for (sp = &shadow[r][c]; n-- > 0; sp++)
 	{
-		switch (charset)
-		{
-		default:      wcr = L'\0';
-		break;
-		case ASCII:   wcr = (wchar_t)ccp->ascii;
-		break;
-		case UNICODE: wcr = *ccp->unicode;
-		break;
-		}
-		if (wch == wcr)
-		{
-			chd = ccp->dos;
-			break;
-		}
+		sp->sh_ch = chd;
+		sp->sh_attr = attr;
 	}
-	return chd;
-#endif  // ROGUE_DOS_CURSES
 }
 
+/*@
+ * The cursor went past the end of the line: on to the next one, like
+ * curses does, except from the last line, stdscr is not scrollok()
+ */
+static
+void
+sh_wrap(void)
+{
+	if (sh_col < COLS)
+		return;
+	if (sh_row < LINES - 1)
+	{
+		sh_col = 0;
+		sh_row++;
+	}
+	else
+		sh_col = COLS - 1;
+}
+
+/*@
+ * Blank the shadow screen and home the cursor, as wclear() does
+ */
+static
+void
+sh_clear(void)
+{
+	register int r;
+
+	for (r = 0; r < MAXLINES; r++)
+		sh_fill(r, 0, MAXCOLS, ' ', A_DOS_NORMAL);
+	sh_row = sh_col = 0;
+}
+#endif  // ROGUE_DOS_CURSES
+
 
 #ifdef ROGUE_DOS_CURSES
 /*@
@@ -770,6 +862,7 @@ cur_clear(void)
 	else
 		blot_out(0,0,LINES-1,COLS-1);
 #else
+	sh_clear();
 	wclear(stdscr);
 #endif
 }
@@ -892,6 +985,7 @@ cur_clrtoeol(void)
 	getrc(&r,&c);
 	blot_out(r,c,r,COLS-1);
 #else
+	sh_fill(sh_row, sh_col, MAXCOLS, ' ', A_DOS_NORMAL);
 	wclrtoeol(stdscr);
 #endif
 }
@@ -921,45 +1015,23 @@ cur_mvinch(r, c)
 }
 
 
-/*
- * put the character on the screen and update the
- * character position
+/*@
+ * The attribute chr is actually shown with when drawn with dos_attr
+ *
+ * In color, things in a room (drawn normal) and in a passage or maze (drawn
+ * standout) each get their own color. Both cur_addch() and its lookup
+ * tables get it from here.
  */
-void
-cur_addch(byte chr)
+static
+byte
+glyph_attr(byte dos_attr, byte chr)
 {
-#ifdef ROGUE_DOS_CURSES
-	int r, c;
-#endif
-	byte old_attr;
-
-#ifdef ROGUE_GRAPHICS
-	/* Render to SDL window if graphics enabled */
-	if (graphics_enabled && tileset_renderer) {
-		/* Clear background at this position first (black) */
-		SDL_SetRenderDrawColor(tileset_renderer, 0, 0, 0, 255);
-		SDL_Rect clear_rect;
-		clear_rect.x = graphics_cursor_col * TILE_WIDTH;
-		clear_rect.y = graphics_cursor_row * TILE_HEIGHT;
-		clear_rect.w = TILE_WIDTH;
-		clear_rect.h = TILE_HEIGHT;
-		SDL_RenderFillRect(tileset_renderer, &clear_rect);
-
-		/* Try to render as sprite first, fallback to ASCII font if no sprite */
-		if (render_dungeon_tile(graphics_cursor_col * TILE_WIDTH,
-		                        graphics_cursor_row * TILE_HEIGHT, chr) != 0) {
-			/* No sprite available - use bitmap font */
-			graphics_draw_char(graphics_cursor_col, graphics_cursor_row, chr);
-		}
-	}
-#endif
-
-	old_attr = ch_attr;
+	register byte attr = dos_attr;
 
 	if (at_table == color_attr)
 	{
 		/* if it is inside a room */
-		if (ch_attr == A_DOS_NORMAL)
+		if (attr == A_DOS_NORMAL)
 		{
 			switch(chr)
 			{
@@ -970,20 +1042,20 @@ cur_addch(byte chr)
 			case URWALL:
 			case LLWALL:
 			case LRWALL:
-				ch_attr = A_DOS_BROWN;  /* brown */
+				attr = A_DOS_BROWN;  /* brown */
 				break;
 			case FLOOR:
-				ch_attr = A_DOS_GREEN | A_DOS_BRIGHT;  /* light green */
+				attr = A_DOS_GREEN | A_DOS_BRIGHT;  /* light green */
 				break;
 			case STAIRS:
-				ch_attr = A_DOS_BLACK | A_DOS_BG(A_DOS_GREEN) | A_DOS_BLINK; /* black on green */
+				attr = A_DOS_BLACK | A_DOS_BG(A_DOS_GREEN) | A_DOS_BLINK; /* black on green */
 				break;
 			case TRAP:
-				ch_attr = A_DOS_MAGENTA;  /* magenta */
+				attr = A_DOS_MAGENTA;  /* magenta */
 				break;
 			case GOLD:
 			case PLAYER:
-				ch_attr = A_DOS_YELLOW;  /* yellow */
+				attr = A_DOS_YELLOW;  /* yellow */
 				break;
 			case POTION:
 			case SCROLL:
@@ -992,24 +1064,24 @@ cur_addch(byte chr)
 			case AMULET:
 			case RING:
 			case WEAPON:
-				ch_attr = A_DOS_BLUE | A_DOS_BRIGHT;
+				attr = A_DOS_BLUE | A_DOS_BRIGHT;
 				break;
 			case FOOD:
-				ch_attr = A_DOS_RED;
+				attr = A_DOS_RED;
 				break;
 			}
 		}
 		/* if inside a passage or a maze */
-		else if (ch_attr == A_DOS_STANDOUT)
+		else if (attr == A_DOS_STANDOUT)
 		{
 			switch(chr)
 			{
 			case FOOD:
-				ch_attr = A_DOS_RED | A_DOS_STANDOUT ;  /* red @ on white */
+				attr = A_DOS_RED | A_DOS_STANDOUT ;  /* red @ on white */
 				break;
 			case GOLD:
 			case PLAYER:
-				ch_attr = A_DOS_YELLOW | A_DOS_STANDOUT;  /* yellow on white */
+				attr = A_DOS_YELLOW | A_DOS_STANDOUT;  /* yellow on white */
 				break;
 			case POTION:
 			case SCROLL:
@@ -1018,14 +1090,117 @@ cur_addch(byte chr)
 			case AMULET:
 			case RING:
 			case WEAPON:
-				ch_attr = A_DOS_BLUE | A_DOS_STANDOUT;  /* blue on white */
+				attr = A_DOS_BLUE | A_DOS_STANDOUT;  /* blue on white */
 				break;
 			}
 		}
 		//@ I suspect STAIRS used with high() is a case that never happen...
-		else if (ch_attr == (A_DOS_BRIGHT | A_DOS_NORMAL) && chr == STAIRS)
-			ch_attr = A_DOS_BLACK | A_DOS_BG(A_DOS_GREEN) | A_DOS_BLINK;
+		else if (attr == (A_DOS_BRIGHT | A_DOS_NORMAL) && chr == STAIRS)
+			attr = A_DOS_BLACK | A_DOS_BG(A_DOS_GREEN) | A_DOS_BLINK;
 	}
+	return attr;
+}
+
+
+#ifndef ROGUE_DOS_CURSES
+/*@
+ * Build the cur_addch() lookup row for dos_attr: for each DOS char, the
+ * attribute it's shown with and its curses cell, ready to be put.
+ */
+static
+CELLROW *
+cell_row(byte dos_attr)
+{
+	register CELLROW *crp;
+	register int chd;
+	byte attr;
+#ifdef ROGUE_WIDECHAR
+	attr_t attrs;
+	short color;
+#endif
+
+	crp = (CELLROW *) newmem(sizeof(CELLROW));
+	for (chd = 0; chd < 256; chd++)
+	{
+		crp->cr_attr[chd] = attr = glyph_attr(dos_attr, (byte)chd);
+		switch (charset)
+		{
+		default:
+		case ASCII:
+			crp->cr_ch[chd] = (byte)ascii_from_dos((byte)chd, ctab)
+					| attr_from_dos(attr);
+			break;
+		case CP437:
+			crp->cr_ch[chd] = (byte)chd | attr_from_dos(attr);
+			break;
+#ifdef ROGUE_WIDECHAR
+		case UNICODE:
+			attrw_from_dos(attr, &attrs, &color);
+			setcchar(&crp->cr_wch[chd],
+					charcode_from_dos((byte)chd, ctab)->unicode,
+					attrs,
+					color,
+					NULL);
+			break;
+#endif  // ROGUE_WIDECHAR
+		}
+	}
+	return cell_rows[dos_attr] = crp;
+}
+
+/*@
+ * Throw the lookup rows away, the colors or charset they were built for
+ * are changing
+ */
+static
+void
+cell_free(void)
+{
+	register int i;
+
+	for (i = 0; i < 256; i++)
+	{
+		free(cell_rows[i]);
+		cell_rows[i] = NULL;
+	}
+}
+#endif  // ROGUE_DOS_CURSES
+
+
+/*
+ * put the character on the screen and update the
+ * character position
+ */
+void
+cur_addch(byte chr)
+{
+#ifdef ROGUE_DOS_CURSES
+	int r, c;
+	byte old_attr;
+#else
+	register CELLROW *crp;
+#endif
+
+#ifdef ROGUE_GRAPHICS
+	/* Render to SDL window if graphics enabled */
+	if (graphics_enabled && tileset_renderer) {
+		/* Clear background at this position first (black) */
+		SDL_SetRenderDrawColor(tileset_renderer, 0, 0, 0, 255);
+		SDL_Rect clear_rect;
+		clear_rect.x = graphics_cursor_col * TILE_WIDTH;
+		clear_rect.y = graphics_cursor_row * TILE_HEIGHT;
+		clear_rect.w = TILE_WIDTH;
+		clear_rect.h = TILE_HEIGHT;
+		SDL_RenderFillRect(tileset_renderer, &clear_rect);
+
+		/* Try to render as sprite first, fallback to ASCII font if no sprite */
+		if (render_dungeon_tile(graphics_cursor_col * TILE_WIDTH,
+		                        graphics_cursor_row * TILE_HEIGHT, chr) != 0) {
+			/* No sprite available - use bitmap font */
+			graphics_draw_char(graphics_cursor_col, graphics_cursor_row, chr);
+		}
+	}
+#endif
 
 #ifdef ROGUE_DOS_CURSES
 	/*@
@@ -1033,6 +1208,8 @@ cur_addch(byte chr)
 	 * or just CR and scroll the whole window content up.
 	 * Otherwise just put the char and advance the cursor.
 	 */
+	old_attr = ch_attr;
+	ch_attr = glyph_attr(ch_attr, chr);
 	getrc(&r,&c);
 	if (chr == '\n') {
 		if (r == LINES-1)
@@ -1050,19 +1227,37 @@ cur_addch(byte chr)
 		putchr(chr);
 		cur_move(r,c+1);
 	}
+	ch_attr = old_attr;
 #else
+	/*@
+	 * Mirror curses: '\n' clears the rest of the line and goes to the next,
+	 * anything else is put and the cursor moves on, wrapping at the end of
+	 * the line.
+	 */
+	if ((crp = cell_rows[(byte)ch_attr]) == NULL)
+		crp = cell_row((byte)ch_attr);
+	if (chr == '\n')
+	{
+		sh_fill(sh_row, sh_col, MAXCOLS, ' ', A_DOS_NORMAL);
+		sh_col = COLS;
+	}
+	else
+	{
+		sh_fill(sh_row, sh_col, 1, chr, crp->cr_attr[chr]);
+		sh_col++;
+	}
+	sh_wrap();
+
 	switch (charset)
 	{
 	default:
 	case ASCII:
-		chr = ascii_from_dos(chr, ctab);
-		/* fallthrough */
 	case CP437:
-		waddch(stdscr, chr | attr_from_dos(ch_attr));
+		waddch(stdscr, crp->cr_ch[chr]);
 		break;
 #ifdef ROGUE_WIDECHAR
 	case UNICODE:
-		wadd_wch(stdscr, unicode_from_dos(chr, ch_attr, ctab));
+		wadd_wch(stdscr, &crp->cr_wch[chr]);
 		break;
 #endif  // ROGUE_WIDECHAR
 	}
@@ -1079,8 +1274,6 @@ cur_addch(byte chr)
 	}
 #endif
 #endif  // ROGUE_DOS_CURSES
-	ch_attr = old_attr;
-	return;
 }
 
 
@@ -1091,8 +1284,10 @@ cur_addstr(s)
 #ifdef ROGUE_DEBUG
 	print_int_calls = FALSE;
 #endif
+	cur_span();
 	while(*s)
-		cur_addch(*s++);
+		cur_spanch(*s++);
+	cur_spanend();
 #ifdef ROGUE_DEBUG
 #ifdef ROGUE_DOS_CURSES
 	printf("\n");
@@ -1101,6 +1296,130 @@ cur_addstr(s)
 #endif
 }
 
+/*@
+ * Spans: runs of cells put on screen with a single curses call
+ *
+ * Between cur_span() and cur_spanend() the cells cur_spanch() puts are kept
+ * in span[] and go out in one waddchnstr() / wadd_wchnstr() when the run is
+ * over: at cur_spanend(), at a '\n', at the end of the line or when span[]
+ * is full. Each cell takes the attribute set when it was put, as with
+ * cur_addch(), and the shadow screen is kept up to date as they are put.
+ *
+ * Nothing else may draw or move the cursor before cur_spanend(), curses
+ * is not told about the cells, nor where the cursor went, until then.
+ * Where there are no spans to be had (DOS, graphics mode) cur_spanch() is
+ * plain cur_addch().
+ */
+#ifndef ROGUE_DOS_CURSES
+static struct {
+	int	sp_row, sp_col;		// where the run starts
+	int	sp_len;			// cells in it
+	chtype	sp_ch[MAXCOLS];		// ASCII and CP437
+#ifdef ROGUE_WIDECHAR
+	cchar_t	sp_wch[MAXCOLS];	// UNICODE
+#endif
+} span;
+#endif
+
+/*@
+ * Start a run of cells at the cursor
+ */
+void
+cur_span(void)
+{
+#ifndef ROGUE_DOS_CURSES
+	span.sp_row = sh_row;
+	span.sp_col = sh_col;
+	span.sp_len = 0;
+#endif
+}
+
+/*@
+ * Put a char in the run, at the cursor, and move the cursor on
+ */
+void
+cur_spanch(byte chr)
+{
+#ifdef ROGUE_DOS_CURSES
+	cur_addch(chr);
+#else
+	register CELLROW *crp;
+
+#ifdef ROGUE_GRAPHICS
+	if (graphics_enabled)
+	{
+		cur_addch(chr);
+		return;
+	}
+#endif
+	if (chr == '\n')
+	{
+		cur_spanend();
+		cur_addch(chr);
+		cur_span();
+		return;
+	}
+	if (span.sp_len == MAXCOLS)
+	{
+		cur_spanend();
+		cur_span();
+	}
+	if ((crp = cell_rows[(byte)ch_attr]) == NULL)
+		crp = cell_row((byte)ch_attr);
+	sh_fill(sh_row, sh_col, 1, chr, crp->cr_attr[chr]);
+	switch (charset)
+	{
+	default:
+	case ASCII:
+	case CP437:
+		span.sp_ch[span.sp_len] = crp->cr_ch[chr];
+		break;
+#ifdef ROGUE_WIDECHAR
+	case UNICODE:
+		span.sp_wch[span.sp_len] = crp->cr_wch[chr];
+		break;
+#endif  // ROGUE_WIDECHAR
+	}
+	span.sp_len++;
+	if (++sh_col >= COLS)
+	{
+		cur_spanend();
+		cur_span();
+	}
+#endif  // ROGUE_DOS_CURSES
+}
+
+/*@
+ * Put the run on screen and leave the cursor after it
+ */
+void
+cur_spanend(void)
+{
+#ifndef ROGUE_DOS_CURSES
+	if (span.sp_len == 0)
+		return;
+	switch (charset)
+	{
+	default:
+	case ASCII:
+	case CP437:
+		mvwaddchnstr(stdscr, span.sp_row, span.sp_col,
+				span.sp_ch, span.sp_len);
+		break;
+#ifdef ROGUE_WIDECHAR
+	case UNICODE:
+		mvwadd_wchnstr(stdscr, span.sp_row, span.sp_col,
+				span.sp_wch, span.sp_len);
+		break;
+#endif  // ROGUE_WIDECHAR
+	}
+	span.sp_len = 0;
+	sh_wrap();
+	wmove(stdscr, sh_row, sh_col);
+#endif  // ROGUE_DOS_CURSES
+}
+
+
 #ifndef ROGUE_DOS_CURSES
 #ifdef ROGUE_WIDECHAR
 cchar_t *
@@ -1351,6 +1670,8 @@ init_curses_colors(void)
 	int colormode;
 	int cmap[16];
 
+	cell_free();
+
 	/*
 	 * Not sure if this test should include bwflag, as set via env file.
 	 * Original winit() doesn't, as it only cares about actual *hardware*
@@ -1803,6 +2124,8 @@ winit(void)
 	scr_type = ROGUE_SCR_TYPE;
 
 	setenv("ESCDELAY", "25", FALSE);
+	if (slow_link)
+		charset = ASCII;
 	initscr();
 	init_curses = TRUE;
 #ifdef ROGUE_GRAPHICS
@@ -1918,6 +2241,7 @@ wdump(void)
 		cur_mvinchnstr(line, 0, savewin[line], COLS);
 	}
 	wmove(stdscr, c_row, c_col);
+	memcpy(shsave, shadow, sizeof(shadow));
 
 	is_saved = TRUE;
 }
@@ -1937,6 +2261,7 @@ wrestor(void)
 		cur_mvaddchnstr(line, 0, savewin[line], COLS);
 	}
 	wmove(stdscr, c_row, c_col);
+	memcpy(shadow, shsave, sizeof(shadow));
 	wrefresh(stdscr);
 
 	is_saved = FALSE;
@@ -2001,10 +2326,18 @@ int
 cur_line(byte chd, int length, bool orientation)
 {
 	chtype ch;
+	int i;
 #ifdef ROGUE_WIDECHAR
 	cchar_t *cch;
 #endif  // ROGUE_WIDECHAR
 
+	//@ the cursor stays put, as with whline() and wvline()
+	if (orientation == VERTICAL)
+		for (i = 0; i < length && sh_row + i < LINES; i++)
+			sh_fill(sh_row + i, sh_col, 1, chd, ch_attr);
+	else
+		sh_fill(sh_row, sh_col, min(length, COLS - sh_col), chd, ch_attr);
+
 	switch (charset)
 	{
 	default:
@@ -2211,10 +2544,8 @@ repchr(byte chr, int cnt)
 		c_col++;
 	}
 #else
-	int c_row, c_col;
-	getyx(stdscr, c_row, c_col);
 	cur_hline(chr, cnt);
-	wmove(stdscr, c_row, c_col + cnt);
+	cur_move(sh_row, sh_col + cnt);
 #endif
 }
 
@@ -2354,6 +2685,7 @@ drop_curtain(void)
 	msleep(delay);  // not in original, optional
 	cur_move(0,0);
 	cur_standend();
+	sh_clear();
 	wclear(stdscr);
 }
 
@@ -2603,7 +2935,10 @@ backspace(void)
 	int r, c;
 	getyx(stdscr, r, c);
 	if (c > 0)
-		wmove(stdscr, r, c-1);
+		cur_move(r, c-1);
+#ifndef ROGUE_DOS_CURSES
+	sh_fill(sh_row, sh_col, 1, ' ', A_DOS_NORMAL);
+#endif
 	wdelch(stdscr);
 	winsch(stdscr, ' ');
 }
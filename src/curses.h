@@ -101,6 +101,7 @@
 extern int LINES, COLS;
 extern int is_saved;
 extern int scr_type;
+extern bool slow_link;
 #ifdef ROGUE_DOS_CURSES
 extern bool iscuron;
 extern int old_page_no;
@@ -173,6 +173,9 @@ void	cur_mvaddch(int r, int c, byte chr);
 byte	cur_mvinch(int r, int c);
 void	cur_addch(byte chr);
 void	cur_addstr(char *s);
+void	cur_span(void);
+void	cur_spanch(byte chr);
+void	cur_spanend(void);
 void	set_attr(int bute);
 void	winit(void);
 void	wdump(void);
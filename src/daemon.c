@@ -9,118 +9,433 @@
 #include "curses.h"
 
 #define EMPTY	0
-#define FULL	1
-#define DAEMON -1
-#define MAXDAEMONS 20
 
 /*@
- * struct delayed_action, as well as functions using it as return type such
- * as d_slot() and find_slot() are now marked static as the struct is not
- * declared in rogue.h, and they are only used in this file
+ * The old fixed d_list[MAXDAEMONS] of 20 slots is gone.  Fuses and daemons
+ * are now wires, handed out from blocks that never move and threaded on
+ * lists, so there is no limit on how many can be lit at once.
+ *
+ * Fuses hang on a two level timing wheel: WHEEL0 slots of one tick each,
+ * then WHEEL0 slots of WHEEL0 ticks each.  Anything further out waits on
+ * w_far until the second wheel comes round.  do_fuses() only looks at the
+ * one slot that is due, spilling a slot of the second wheel into the first
+ * every WHEEL0 ticks, instead of counting every fuse down every turn.
+ *
+ * Every wire also sits on a chain by function, which is how lengthen() and
+ * extinguish() find it without a scan.  fuse() and start_daemon() return a
+ * handle that fuse_lengthen() and fuse_cancel() take directly; a handle
+ * whose wire has gone off since is just ignored.
+ *
+ * Fuses take no arguments.  Daemons are registered with a name, a priority
+ * (lowest runs first, then in the order they were started), how many turns
+ * apart they run and a payload pointer they are handed each time.  Each one
+ * keeps how often it ran and for how long, for the wizard's ^P screen.
  */
+#define WHEEL0	64		/* Slots in each wheel, a power of 2 */
+#define WSHIFT	6		/* log2(WHEEL0) */
+#define WBLOCK	32		/* Wires allocated at a time */
+#define WFUNCS	16		/* Chains by function, a power of 2 */
 
-/*@
- * `int d_arg` member was removed as all fuses and daemons have no arguments,
- * and for the only one that did, turn_see(), the argument type is bool. It's
- * also now wrapped and no longer directly used as fuse, as its return type is
- * not void, making the argument member of this struct unneeded.
- *
- * A solution to handle generic functions of multiple return and argument types
- * would be a somewhat complex approach using unions to simulate overload, a
- * sophistication not needed for Rogue.
+#define W_HANDLE(wp)	((wp)->w_id << 8 | (wp)->w_gen)
+#define W_FUNC(f)	(&w_func[((intptr) (f) >> 4) & (WFUNCS - 1)])
+
+static
+struct wire {
+	struct wire *w_next, *w_prev;	/* On a wheel slot or the daemons */
+	struct wire *w_fnext, *w_fprev;	/* On its chain by function */
+	void (*w_func)();		/* For a daemon, takes w_arg */
+	long w_when;			/* Tick it goes off or next runs on */
+	int w_id;			/* Its index, for the handle */
+	byte w_gen;			/* Bumped each time it is reused */
+	/*
+	 * Daemons only
+	 */
+	int w_every;			/* Turns between runs, 0 for a fuse */
+	int w_prio;			/* Lowest runs first */
+	char *w_name;
+	void *w_arg;			/* Payload handed to w_func */
+	long w_calls;			/* Times it has run */
+	long w_nsec;			/* Time spent in it */
+} w_wheel[2][WHEEL0], w_far, w_daemons, w_func[WFUNCS];
+
+typedef void (*dfunc)(void *);
+
+static struct wire **w_blk;		/* The blocks of wires */
+static int w_nblk;
+static struct wire *w_free;		/* Wires not in use, on w_next */
+static long w_now;			/* Ticks of do_fuses() so far */
+static long d_now;			/* Ticks of do_daemons() so far */
+static bool d_running;			/* In do_daemons(), don't unlink */
+
+static void	w_init(void);
+static struct wire	*w_get(void (*func)(), long at);
+static void	w_put(struct wire *wp);
+static void	w_link(struct wire *head, struct wire *wp);
+static void	w_unlink(struct wire *wp);
+static void	w_hang(struct wire *wp);
+static void	w_spill(struct wire *head);
+static struct wire	*w_find(void (*func)());
+static struct wire	*w_handle(int h);
+static char	*d_line(struct wire *wp);
+
+/*
+ * w_init:
+ *	Make every list head point at itself
  */
 static
-struct delayed_action {
-	void (*d_func)();
-	int d_time;
-} d_list[MAXDAEMONS];
+void
+w_init(void)
+{
+	register struct wire *wp;
+
+	for (wp = &w_wheel[0][0]; wp < &w_wheel[2][0]; wp++)
+		wp->w_next = wp->w_prev = wp;
+	w_far.w_next = w_far.w_prev = &w_far;
+	w_daemons.w_next = w_daemons.w_prev = &w_daemons;
+	for (wp = w_func; wp < &w_func[WFUNCS]; wp++)
+		wp->w_fnext = wp->w_fprev = wp;
+}
 
 /*
- * d_slot:
- *	Find an empty slot in the daemon/fuse list
+ * w_get:
+ *	Take a wire off the free list, making a new block if there
+ *	are none, and put it on the chain for func
  */
 static
-struct delayed_action *
-d_slot(void)
+struct wire *
+w_get(void (*func)(), long at)
 {
-	register struct delayed_action *dev;
+	register struct wire *wp, *head;
+	register int i;
 
-	for (dev = d_list; dev < &d_list[MAXDAEMONS]; dev++)
-		if (dev->d_func == EMPTY)
-			return dev;
-#ifdef DEBUG
-	debug("Ran out of fuse slots");
-#endif
-	return NULL;
+	if (w_daemons.w_next == NULL)
+		w_init();
+	if (w_free == NULL)
+	{
+		struct wire **nblk;
+
+		nblk = (struct wire **) newmem((w_nblk + 1) * sizeof(struct wire *));
+		if (w_blk != NULL)
+			memcpy(nblk, w_blk, w_nblk * sizeof(struct wire *));
+		free(w_blk);
+		w_blk = nblk;
+		wp = w_blk[w_nblk] = (struct wire *) newmem(WBLOCK * sizeof(struct wire));
+		setmem(wp, WBLOCK * sizeof(struct wire), 0);
+		for (i = WBLOCK; i--; ) {
+			wp[i].w_id = w_nblk * WBLOCK + i;
+			wp[i].w_next = w_free;
+			w_free = &wp[i];
+		}
+		w_nblk++;
+	}
+	wp = w_free;
+	w_free = wp->w_next;
+	wp->w_func = func;
+	wp->w_when = at;
+	wp->w_every = 0;
+	head = W_FUNC(func);
+	wp->w_fnext = head->w_fnext;
+	wp->w_fprev = head;
+	head->w_fnext->w_fprev = wp;
+	head->w_fnext = wp;
+	return wp;
 }
 
 /*
- * find_slot:
- *	Find a particular slot in the table
+ * w_put:
+ *	Give back a wire that is off every list but its function's
  */
 static
-struct delayed_action *
-find_slot(void (*func)())
+void
+w_put(struct wire *wp)
 {
-	register struct delayed_action *dev;
+	wp->w_fprev->w_fnext = wp->w_fnext;
+	wp->w_fnext->w_fprev = wp->w_fprev;
+	wp->w_func = EMPTY;
+	wp->w_gen++;
+	wp->w_next = w_free;
+	w_free = wp;
+}
 
-	for (dev = d_list; dev < &d_list[MAXDAEMONS]; dev++)
-	if (func == dev->d_func)
-		return dev;
+/*
+ * w_link:
+ *	Put a wire at the end of a list
+ */
+static
+void
+w_link(struct wire *head, struct wire *wp)
+{
+	wp->w_next = head;
+	wp->w_prev = head->w_prev;
+	head->w_prev->w_next = wp;
+	head->w_prev = wp;
+}
+
+/*
+ * w_unlink:
+ *	Take a wire off whatever list it is on
+ */
+static
+void
+w_unlink(struct wire *wp)
+{
+	wp->w_prev->w_next = wp->w_next;
+	wp->w_next->w_prev = wp->w_prev;
+}
+
+/*
+ * w_hang:
+ *	Put a fuse on the slot of the wheel it belongs on now.  One due
+ *	this very tick is only hung while the wheel turns, before the
+ *	slot goes off.
+ */
+static
+void
+w_hang(struct wire *wp)
+{
+	if (wp->w_when - w_now < WHEEL0)
+		w_link(&w_wheel[0][wp->w_when & (WHEEL0 - 1)], wp);
+	else if ((wp->w_when >> WSHIFT) - (w_now >> WSHIFT) <= WHEEL0)
+		w_link(&w_wheel[1][(wp->w_when >> WSHIFT) & (WHEEL0 - 1)], wp);
+	else
+		w_link(&w_far, wp);
+}
+
+/*
+ * w_spill:
+ *	Hang everything on a list again, now that the wheel has turned
+ */
+static
+void
+w_spill(struct wire *head)
+{
+	register struct wire *wp;
+	struct wire hold;
+
+	if (head->w_next == head)
+		return;
+	hold.w_next = head->w_next;
+	hold.w_prev = head->w_prev;
+	hold.w_next->w_prev = hold.w_prev->w_next = &hold;
+	head->w_next = head->w_prev = head;
+	while ((wp = hold.w_next) != &hold) {
+		w_unlink(wp);
+		w_hang(wp);
+	}
+}
+
+/*
+ * w_find:
+ *	The most recently lit wire for func, if any
+ */
+static
+struct wire *
+w_find(void (*func)())
+{
+	register struct wire *wp, *head;
+
+	if (func == EMPTY || w_daemons.w_next == NULL)
+		return NULL;
+	head = W_FUNC(func);
+	for (wp = head->w_fnext; wp != head; wp = wp->w_fnext)
+		if (wp->w_func == func)
+			return wp;
 	return NULL;
 }
 
+/*
+ * w_handle:
+ *	The wire a handle is for, if it hasn't gone off since
+ */
+static
+struct wire *
+w_handle(int h)
+{
+	register struct wire *wp;
+	register int id = h >> 8;
+
+	if (id < 0 || id >= w_nblk * WBLOCK)
+		return NULL;
+	wp = &w_blk[id / WBLOCK][id % WBLOCK];
+	if (wp->w_func == EMPTY || wp->w_gen != (h & 0xff))
+		return NULL;
+	return wp;
+}
+
 /*
  * daemon:
- *	Start a daemon, takes a function.
+ *	Start a daemon, takes a name, a priority, how many turns apart
+ *	it runs, the function and the payload to hand it.
  */
-void
-start_daemon(void (*func)())
+int
+start_daemon(char *name, int prio, int every, void (*func)(void *), void *arg)
 {
-	register struct delayed_action *dev;
+	register struct wire *wp, *op;
 
-	dev = d_slot();
-	dev->d_func = func;
-	dev->d_time = DAEMON;
+	wp = w_get(func, d_now + 1);
+	wp->w_every = max(every, 1);
+	wp->w_prio = prio;
+	wp->w_name = name;
+	wp->w_arg = arg;
+	wp->w_calls = wp->w_nsec = 0;
+	/*
+	 * After every daemon of the same or lower priority
+	 */
+	for (op = w_daemons.w_prev; op != &w_daemons; op = op->w_prev)
+		if (op->w_prio <= prio)
+			break;
+	w_link(op->w_next, wp);
+	return W_HANDLE(wp);
 }
 
 /*
  * do_daemons:
- *	Run all the daemons, passing the argument to the function.
+ *	Run all the daemons that are due, passing each its payload.
  */
 void
 do_daemons(void)
 {
-	register struct delayed_action *dev;
+	register struct wire *wp, *nwp;
+	long start;
 
 	/*
-	 * Loop through the devil list
+	 * Loop through the devil list, in order of priority.
+	 * One may put out another (or itself) while we're here, so
+	 * they're only marked and the list is swept after.
 	 */
-	for (dev = d_list; dev < &d_list[MAXDAEMONS]; dev++)
-	{
-		/*
-		 * Executing each one, giving it the proper arguments
-		 * @ Sorry, no more "arguments". And it was a single one.
-		 */
-		if (dev->d_time == DAEMON && dev->d_func != EMPTY)
+	if (w_daemons.w_next == NULL)
+		return;
+	d_now++;
+	d_running = TRUE;
+	for (wp = w_daemons.w_next; wp != &w_daemons; wp = wp->w_next)
+		if (wp->w_func != EMPTY && wp->w_when <= d_now)
 		{
-			(*dev->d_func)();
+			wp->w_when = d_now + wp->w_every;
+			start = md_nsec();
+			(*(dfunc) wp->w_func)(wp->w_arg);
+			wp->w_nsec += md_nsec() - start;
+			wp->w_calls++;
+		}
+	d_running = FALSE;
+	for (wp = w_daemons.w_next; wp != &w_daemons; wp = nwp) {
+		nwp = wp->w_next;
+		if (wp->w_func == EMPTY) {
+			w_unlink(wp);
+			wp->w_next = w_free;
+			w_free = wp;
 		}
 	}
 }
 
+static char d_head[] = "daemon     prio  every      calls    total ms  usec/call";
+
+/*
+ * d_line:
+ *	What a daemon has cost so far, as a line of the report
+ */
+static
+char *
+d_line(struct wire *wp)
+{
+	static char line[MAXSTR];
+
+	snprintf(line, sizeof(line), "%-10.10s %4d  %5d  %9ld  %10.3f  %9.2f",
+		wp->w_name, wp->w_prio, wp->w_every, wp->w_calls,
+		wp->w_nsec / 1e6,
+		wp->w_calls ? wp->w_nsec / 1e3 / wp->w_calls : 0.0);
+	return line;
+}
+
+#ifdef WIZARD
+/*
+ * d_report:
+ *	Show the wizard what each daemon has cost so far
+ */
+void
+d_report(void)
+{
+	register struct wire *wp;
+
+	add_line(nullstr, "%s", d_head);
+	if (w_daemons.w_next != NULL)
+		for (wp = w_daemons.w_next; wp != &w_daemons; wp = wp->w_next)
+			if (wp->w_func != EMPTY)
+				add_line(nullstr, "%s", d_line(wp));
+	end_line(nullstr);
+}
+#endif
+
+/*
+ * d_print:
+ *	Print the same once the screen is closed, see md_exit()
+ */
+void
+d_print(void)
+{
+	register struct wire *wp;
+
+	if (w_daemons.w_next == NULL)
+		return;
+	printf("%s\n", d_head);
+	for (wp = w_daemons.w_next; wp != &w_daemons; wp = wp->w_next)
+		if (wp->w_func != EMPTY)
+			printf("%s\n", d_line(wp));
+}
+
 /*
  * fuse:
  *	Start a fuse to go off in a certain number of turns
  */
-void
+int
 fuse(void (*func)(), int time)
 {
-	register struct delayed_action *wire;
+	register struct wire *wp;
+
+	wp = w_get(func, w_now + max(time, 1));
+	w_hang(wp);
+	return W_HANDLE(wp);
+}
 
-	wire = d_slot();
-	wire->d_func = func;
-	wire->d_time = time;
+/*
+ * fuse_lengthen:
+ *	Increase the time until the fuse with handle h goes off
+ */
+void
+fuse_lengthen(int h, int xtime)
+{
+	register struct wire *wp;
+
+	if ((wp = w_handle(h)) == NULL || wp->w_every != 0)
+		return;
+	w_unlink(wp);
+	if ((wp->w_when += xtime) <= w_now)
+		wp->w_when = w_now + 1;
+	w_hang(wp);
+}
+
+/*
+ * fuse_cancel:
+ *	Put out the fuse or daemon with handle h
+ */
+void
+fuse_cancel(int h)
+{
+	register struct wire *wp;
+
+	if ((wp = w_handle(h)) == NULL)
+		return;
+	if (wp->w_every != 0 && d_running) {
+		/*
+		 * do_daemons() is walking the list, let it unlink this
+		 */
+		wp->w_fprev->w_fnext = wp->w_fnext;
+		wp->w_fnext->w_fprev = wp->w_fprev;
+		wp->w_func = EMPTY;
+		wp->w_gen++;
+		return;
+	}
+	w_unlink(wp);
+	w_put(wp);
 }
 
 /*
@@ -130,11 +445,11 @@ fuse(void (*func)(), int time)
 void
 lengthen(void (*func)(), int xtime)
 {
-	register struct delayed_action *wire;
+	register struct wire *wp;
 
-	if ((wire = find_slot(func)) == NULL)
+	if ((wp = w_find(func)) == NULL)
 		return;
-	wire->d_time += xtime;
+	fuse_lengthen(W_HANDLE(wp), xtime);
 }
 
 /*
@@ -144,34 +459,72 @@ lengthen(void (*func)(), int xtime)
 void
 extinguish(void (*func)())
 {
-	register struct delayed_action *wire;
+	register struct wire *wp;
 
-	if ((wire = find_slot(func)) == NULL)
+	if ((wp = w_find(func)) == NULL)
 		return;
-	wire->d_func = EMPTY;
+	fuse_cancel(W_HANDLE(wp));
 }
 
 /*
  * do_fuses:
- *	Decrement counters and start needed fuses
+ *	Turn the wheel one tick and start the fuses that are due
  */
 void
 do_fuses(void)
 {
-	register struct delayed_action *wire;
+	register struct wire *wp, *head;
+	register int slot;
+	struct wire due;
 
+	if (w_daemons.w_next == NULL)
+		w_init();
+	w_now++;
 	/*
-	 * Step though the list
+	 * Every WHEEL0 ticks the next slot of the second wheel comes
+	 * down into the first, and once round the second wheel anything
+	 * on w_far gets another look.
 	 */
-	for (wire = d_list; wire < &d_list[MAXDAEMONS]; wire++) {
+	if ((w_now & (WHEEL0 - 1)) == 0) {
+		slot = (w_now >> WSHIFT) & (WHEEL0 - 1);
+		if (slot == 0)
+			w_spill(&w_far);
+		w_spill(&w_wheel[1][slot]);
+	}
 	/*
-	 * Decrementing counters and starting things we want.  We also need
-	 * to remove the fuse from the list once it has gone off.
+	 * Move the due ones to a list of their own first: going off, a
+	 * fuse can light new ones on this slot or put out others.
 	 */
-		if (wire->d_func != EMPTY && wire->d_time > 0 && --wire->d_time == 0)
-		{
-			(*wire->d_func)();
-			wire->d_func = EMPTY;
-		}
+	head = &w_wheel[0][w_now & (WHEEL0 - 1)];
+	if (head->w_next == head)
+		return;
+	due.w_next = head->w_next;
+	due.w_prev = head->w_prev;
+	due.w_next->w_prev = due.w_prev->w_next = &due;
+	head->w_next = head->w_prev = head;
+	while ((wp = due.w_next) != &due) {
+		void (*func)() = wp->w_func;
+
+		w_unlink(wp);
+		w_put(wp);
+		(*func)();
 	}
 }
+
+/*
+ * d_free:
+ *	Give back the memory of the fuses and daemons
+ */
+void
+d_free(void)
+{
+	register int i;
+
+	for (i = 0; i < w_nblk; i++)
+		free(w_blk[i]);
+	free(w_blk);
+	w_blk = NULL;
+	w_nblk = 0;
+	w_free = NULL;
+	w_daemons.w_next = NULL;
+}
@@ -13,10 +13,12 @@
  *	A healing daemon that restores hit points after rest
  */
 void
-doctor(void)
+doctor(void *arg)
 {
 	register int lv, ohp;
 
+	(void) arg;	//@ no payload
+
 	lv = pstats.s_lvl;
 	ohp = pstats.s_hpt;
 	quiet++;
@@ -47,7 +49,7 @@ doctor(void)
 void
 swander(void)
 {
-	start_daemon(rollwand);
+	start_daemon("wander", DP_WANDER, 1, rollwand, NULL);
 }
 
 /*
@@ -55,10 +57,12 @@ swander(void)
  *	Called to roll to see if a wandering monster starts up
  */
 void
-rollwand(void)
+rollwand(void *arg)
 {
 	static int between = 0;
 
+	(void) arg;	//@ no payload
+
 	if (++between >= 3 + rnd(3))
 	{
 		if (roll(1, 6) == 4)
@@ -108,6 +112,7 @@ sight(void)
 	{
 		extinguish(sight);
 		player.t_flags &= ~ISBLIND;
+		fov_reset();
 		if (!(proom->r_flags & ISGONE))
 			enter_room(&hero);
 		msg("the veil of darkness lifts");
@@ -130,10 +135,12 @@ nohaste(void)
  *	Digest the hero's food
  */
 void
-stomach(void)
+stomach(void *arg)
 {
 	register int oldfood, deltafood;
 
+	(void) arg;	//@ no payload
+
 	if (food_left <= 0)
 	{
 		if (food_left-- < -STARVETIME)
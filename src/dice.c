@@ -0,0 +1,140 @@
+/*
+ * Compiled damage dice: a damage string like "1d8/1d8/3d6" is worked
+ * out once, the first time it's seen, and kept in a table.  THINGs
+ * only hold the index, so combat never parses a string on a swing.
+ *
+ * dice.c
+ */
+
+#include "rogue.h"
+#include "curses.h"
+
+/*
+ * The table starts with entry 0, no attacks at all, so a cleared
+ * THING can't hit.  dice_str[] keeps a copy of each damage string.
+ */
+static struct dice dice_none[1];
+static char **dice_str;
+static int dice_count = 1, dice_size = 1;
+
+struct dice *dice_tab = dice_none;
+
+static void	dice_set(struct dice *dp, const char *str);
+static void	dice_grow(void);
+
+/*
+ * dice_id:
+ *	The index of a damage string in the table, adding it if it's new.
+ *	A NULL string is entry 0.
+ */
+int
+dice_id(const char *str)
+{
+	register int id;
+
+	if (str == NULL)
+		return 0;
+	for (id = 1; id < dice_count; id++)
+		if (strcmp(dice_str[id], str) == 0)
+			return id;
+	if (dice_count == dice_size)
+		dice_grow();
+	dice_str[id] = newmem(strlen(str) + 1);
+	strcpy(dice_str[id], str);
+	dice_set(&dice_tab[id], str);
+	return dice_count++;
+}
+
+/*
+ * dice_grow:
+ *	Double the room in the table
+ */
+static
+void
+dice_grow(void)
+{
+	struct dice *ntab;
+	char **nstr;
+
+	dice_size *= 2;
+	ntab = (struct dice *) newmem(dice_size * sizeof(struct dice));
+	nstr = (char **) newmem(dice_size * sizeof(char *));
+	memcpy(ntab, dice_tab, dice_count * sizeof(struct dice));
+	if (dice_str != NULL)
+		memcpy(nstr, dice_str, dice_count * sizeof(char *));
+	nstr[0] = NULL;
+	if (dice_tab != dice_none)
+		free(dice_tab);
+	free(dice_str);
+	dice_tab = ntab;
+	dice_str = nstr;
+}
+
+/*
+ * dice_set:
+ *	Compile a damage string into dp.  Each attack is "NdS", optionally
+ *	followed by "+P" or "-P", and attacks are separated by '/'.
+ */
+static
+void
+dice_set(struct dice *dp, const char *str)
+{
+	register const char *cp;
+	register struct attack *ap;
+	int sides;
+
+	setmem(dp, sizeof(struct dice), 0);
+	for (cp = str; cp != NULL && dp->d_natt < MAXATTACK; cp++) {
+		ap = &dp->d_att[dp->d_natt];
+		ap->a_count = atoi(cp);
+		if ((cp = stpchr(cp, 'd')) == NULL)
+			break;
+		ap->a_sides = sides = atoi(++cp);
+		while (is_digit(*cp))
+			cp++;
+		if (*cp == '+' || *cp == '-')
+			ap->a_plus = atoi(cp);
+		dp->d_natt++;
+		/*
+		 * The mean and spread of a roll of count dice, each even over
+		 * 1..sides; the average is rounded per attack as the threat
+		 * scores always have been.
+		 */
+		if (sides > 0) {
+			dp->d_avg += ap->a_count * (sides + 1) / 2 + ap->a_plus;
+			dp->d_mean += ap->a_count * (sides + 1) / 2.0f + ap->a_plus;
+			dp->d_var += ap->a_count * (sides * sides - 1) / 12.0f;
+		}
+		if ((cp = stpchr(cp, '/')) == NULL)
+			break;
+	}
+}
+
+/*
+ * dice_roll:
+ *	Roll one attack
+ */
+int
+dice_roll(const struct attack *ap)
+{
+	return roll(ap->a_count, ap->a_sides) + ap->a_plus;
+}
+
+/*
+ * dice_free:
+ *	Give back the memory of the table
+ */
+void
+dice_free(void)
+{
+	register int id;
+
+	for (id = 1; id < dice_count; id++)
+		free(dice_str[id]);
+	free(dice_str);
+	if (dice_tab != dice_none)
+		free(dice_tab);
+	dice_tab = dice_none;
+	dice_str = NULL;
+	dice_count = dice_size = 1;
+}
@@ -12,7 +12,7 @@
 
 #define ERROR   -1
 #define MATCH    0
-#define MAXEP	 8
+#define MAXEP	10
 #define FOREVER	 1
 
 //@ made static. could also be hardcoded in struct environment element array
@@ -24,6 +24,8 @@ static char l_fruit[] = "fruit";
 static char l_drive[] = "drive";
 static char l_menu [] = "menu";
 static char l_screen[]   = "screen";
+static char l_frame[]    = "frame";
+static char l_link[]     = "link";
 
 //@ public extern'ed vars
 char whoami[] = "Rodney\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0";
@@ -34,6 +36,8 @@ char fruit[]    =  "Slime Mold\0\0\0\0\0\0\0\0\0\0\0\0\0";
 char s_drive[]  =  "?";
 char s_menu[]   =  "on\0";
 char s_screen[]    =  "\0w fast";
+char s_frame[]     =  "50\0\0\0";
+char s_link[]      =  "fast\0";
 
 static
 struct environment {
@@ -49,6 +53,8 @@ struct environment {
 	{l_drive,	s_drive,	 1},
 	{l_menu,	s_menu,		 3},
 	{l_screen,	s_screen,	 7},
+	{l_frame,	s_frame,	 4},
+	{l_link,	s_link,		 4},
 };
 
 static byte	peekc(void);
@@ -150,6 +156,7 @@ setenv_from_file(envfile)
 	 */
 	lcase(s_menu);
 	lcase(s_screen);
+	lcase(s_link);
 	return TRUE;
 }
 
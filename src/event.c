@@ -0,0 +1,276 @@
+/*
+ * Game events: the engine says what happened (a monster moved, something
+ * was picked up, someone took damage, a message, a tile changed) and the
+ * sinks that asked for that kind of event hear about it.
+ *
+ * event.c
+ *
+ * A sink either takes each event as it is posted, or the whole turn's
+ * worth at once when command() calls ev_flush().  Posting is guarded
+ * with EV_ON() at the call site, so a kind of event no sink wants costs
+ * one test of ev_want and nothing is built or queued.
+ */
+
+#include "rogue.h"
+#include "curses.h"
+
+#define MAXSINK	8
+
+static struct sink {
+	int s_mask;			/* EV_BIT()s of the events it wants */
+	bool s_now;			/* As posted, not once a turn */
+	void (*s_func)(struct event *ep, int n, void *arg);
+	void *s_arg;
+} ev_sinks[MAXSINK];
+
+int ev_want;				/* Events some sink wants */
+static int ev_batched;			/* Events a batched sink wants */
+
+static struct event *ev_queue;		/* This turn's events */
+static int ev_count, ev_size;
+static char *ev_chars;			/* The text of this turn's messages */
+static int ev_nchars, ev_csize;
+
+static void	ev_mask(void);
+static void	ev_post(struct event *ep);
+
+/*
+ * ev_sink:
+ *	Plug in a sink for the events in mask.  It gets them one at a
+ *	time as they happen if now is set, otherwise a turn at a time.
+ */
+int
+ev_sink(int mask, bool now, void (*func)(struct event *ep, int n, void *arg),
+    void *arg)
+{
+	register struct sink *sp;
+
+	for (sp = ev_sinks; sp < &ev_sinks[MAXSINK]; sp++)
+		if (sp->s_func == NULL) {
+			sp->s_mask = mask;
+			sp->s_now = now;
+			sp->s_func = func;
+			sp->s_arg = arg;
+			ev_mask();
+			return sp - ev_sinks;
+		}
+#ifdef DEBUG
+	debug("Ran out of event sinks");
+#endif
+	return -1;
+}
+
+/*
+ * ev_unsink:
+ *	Unplug a sink
+ */
+void
+ev_unsink(int id)
+{
+	if (id < 0 || id >= MAXSINK)
+		return;
+	ev_sinks[id].s_func = NULL;
+	ev_mask();
+}
+
+/*
+ * ev_mask:
+ *	Work out again what the sinks want between them
+ */
+static
+void
+ev_mask(void)
+{
+	register struct sink *sp;
+
+	ev_want = ev_batched = 0;
+	for (sp = ev_sinks; sp < &ev_sinks[MAXSINK]; sp++)
+		if (sp->s_func != NULL) {
+			ev_want |= sp->s_mask;
+			if (!sp->s_now)
+				ev_batched |= sp->s_mask;
+		}
+}
+
+/*
+ * ev_post:
+ *	Hand an event to the sinks that want it now and keep it for the
+ *	ones that want the turn's worth
+ */
+static
+void
+ev_post(struct event *ep)
+{
+	register struct sink *sp;
+	register int bit = EV_BIT(ep->ev_type);
+
+	for (sp = ev_sinks; sp < &ev_sinks[MAXSINK]; sp++)
+		if (sp->s_func != NULL && sp->s_now && (sp->s_mask & bit))
+			(*sp->s_func)(ep, 1, sp->s_arg);
+	if (!(ev_batched & bit))
+		return;
+	if (ev_count == ev_size) {
+		struct event *nq;
+
+		ev_size = ev_size ? ev_size * 2 : 64;
+		nq = (struct event *) newmem(ev_size * sizeof(struct event));
+		if (ev_queue != NULL)
+			memcpy(nq, ev_queue, ev_count * sizeof(struct event));
+		free(ev_queue);
+		ev_queue = nq;
+	}
+	ev_queue[ev_count++] = *ep;
+}
+
+/*
+ * ev_flush:
+ *	The turn is over, give the batched sinks what happened in it
+ */
+void
+ev_flush(void)
+{
+	register struct sink *sp;
+
+	if (ev_count == 0)
+		return;
+	for (sp = ev_sinks; sp < &ev_sinks[MAXSINK]; sp++)
+		if (sp->s_func != NULL && !sp->s_now)
+			(*sp->s_func)(ev_queue, ev_count, sp->s_arg);
+	ev_count = 0;
+	ev_nchars = 0;
+}
+
+/*
+ * ev_text:
+ *	The text of a message event, good until the end of the turn
+ */
+char *
+ev_text(struct event *ep)
+{
+	return &ev_chars[ep->ev_amount];
+}
+
+/*
+ * ev_moved:
+ *	A monster went from one square to another
+ */
+void
+ev_moved(THING *tp, coord *from)
+{
+	struct event ev;
+
+	ev.ev_type = EV_MOVED;
+	ev.ev_ch = tp->t_type;
+	ev.ev_pos = tp->t_pos;
+	ev.ev_from = *from;
+	ev.ev_who = tp->l_id;
+	ev.ev_other = -1;
+	ev.ev_amount = 0;
+	ev_post(&ev);
+}
+
+/*
+ * ev_picked:
+ *	The hero (tp NULL) or a monster picked up obj where it stood
+ */
+void
+ev_picked(THING *tp, THING *obj)
+{
+	struct event ev;
+
+	ev.ev_type = EV_PICKED;
+	ev.ev_ch = obj->o_type;
+	ev.ev_pos = tp == NULL ? hero : obj->o_pos;
+	ev.ev_from = ev.ev_pos;
+	ev.ev_who = tp == NULL ? -1 : tp->l_id;
+	ev.ev_other = obj->l_id;
+	ev.ev_amount = obj->o_count;
+	ev_post(&ev);
+}
+
+/*
+ * ev_damage:
+ *	The attacker took amount hit points off the defender; either is
+ *	the hero if it is &player
+ */
+void
+ev_damage(THING *att, THING *def, int amount)
+{
+	struct event ev;
+
+	ev.ev_type = EV_DAMAGE;
+	ev.ev_ch = def == &player ? PLAYER : def->t_type;
+	ev.ev_pos = def == &player ? hero : def->t_pos;
+	ev.ev_from = att == &player ? hero : att->t_pos;
+	ev.ev_who = def == &player ? -1 : def->l_id;
+	ev.ev_other = att == &player ? -1 : att->l_id;
+	ev.ev_amount = amount;
+	ev_post(&ev);
+}
+
+/*
+ * ev_message:
+ *	A message went up on the top line
+ */
+void
+ev_message(char *text)
+{
+	struct event ev;
+	register int len = strlen(text) + 1;
+
+	setmem(&ev, sizeof(ev), 0);
+	ev.ev_type = EV_MESSAGE;
+	ev.ev_who = ev.ev_other = -1;
+	if (ev_nchars + len > ev_csize) {
+		char *nc;
+
+		ev_csize = max(ev_csize * 2, ev_nchars + len + BUFSIZE);
+		nc = newmem(ev_csize);
+		if (ev_chars != NULL)
+			memcpy(nc, ev_chars, ev_nchars);
+		free(ev_chars);
+		ev_chars = nc;
+	}
+	strcpy(&ev_chars[ev_nchars], text);
+	ev.ev_amount = ev_nchars;
+	ev_nchars += len;
+	ev_post(&ev);
+	if (!(ev_batched & EV_BIT(EV_MESSAGE)))
+		ev_nchars = 0;
+}
+
+/*
+ * ev_tile:
+ *	What is shown at y, x changed to ch: the monster tp if it is not
+ *	NULL, standing out if so is set
+ */
+void
+ev_tile(int y, int x, byte ch, THING *tp, bool so)
+{
+	struct event ev;
+
+	setmem(&ev, sizeof(ev), 0);
+	ev.ev_type = EV_TILE;
+	ev.ev_ch = ch;
+	ev.ev_pos.y = y;
+	ev.ev_pos.x = x;
+	ev.ev_from = ev.ev_pos;
+	ev.ev_who = tp == NULL ? -1 : tp->l_id;
+	ev.ev_other = -1;
+	ev.ev_amount = so;
+	ev_post(&ev);
+}
+
+/*
+ * ev_free:
+ *	Give back the memory of the queue
+ */
+void
+ev_free(void)
+{
+	free(ev_queue);
+	free(ev_chars);
+	ev_queue = NULL;
+	ev_chars = NULL;
+	ev_count = ev_size = ev_nchars = ev_csize = 0;
+}
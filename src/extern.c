@@ -377,6 +377,7 @@ bool fastmode = FALSE;			/* Run until you see something */
 bool faststate = FALSE;			/* Toggle for find (see above) */
 /* bool fight_flush = TRUE;	*/	/* True if toilet input */
 bool firstmove = FALSE;			/* First move after setting door_stop */
+bool horde = FALSE;			/* Fill every level with monsters */
 /* bool jump = FALSE;	*/		/* Show running as series of jumps */
 /* bool passgo = TRUE;	*/		/* Follow passages */
 bool playing = TRUE;			/* True until he quits */
@@ -485,6 +486,7 @@ struct room passages[MAXPASS] =		/* One for each passage */
 struct stats max_stats = INIT_STATS;	/* The maximum for the player */
 
 THING player;				/* The rogue */
+struct room *proom;			/* The room he is in; THINGs keep a room_id() */
 THING *lvl_obj = NULL;			/* List of objects on this level */
 THING *mlist = NULL;			/* List of monsters on the level */
 
@@ -172,6 +172,10 @@ int 	md_keyboard_leds(void);
 long	md_time(void);
 TM  	*md_localtime(void);
 void	md_nanosleep(long nanoseconds);
+long	md_nsec(void);
+long	md_wbytes(void);
+void	show_frame(bool now);
+void	link_turn(void);
 
 //@ dos.asm
 int 	csum();
@@ -210,5 +214,6 @@ extern bool print_int_calls;
 extern int current_drive;
 extern int last_drive;
 #endif
+extern int frame_ms;
 
 #endif //EXTERN_H
@@ -10,7 +10,12 @@
 static int last_player_damage = 0;
 static int last_monster_damage = 0;
 
-static int	parse_average_damage(const char *dice);
+/*
+ * The player's power score, worked out again only after power_reset()
+ */
+static int power_score = 0;
+static bool power_valid = FALSE;
+
 static int	player_offense_score(void);
 static int	player_defense_score(void);
 static int	monster_offense_score(const THING *monster);
@@ -21,42 +26,16 @@ static threat_level_t	assess_threat(const THING *monster);
 static const char	*threat_label(threat_level_t level);
 static void	apply_threat_color(threat_level_t level);
 
-static int
-parse_average_damage(const char *dice)
-{
-	int total = 0;
-	const char *cursor = dice;
-
-	if (dice == NULL)
-		return 0;
-
-	while (cursor != NULL && *cursor != '\0') {
-		int count = atoi(cursor);
-		const char *d = strchr(cursor, 'd');
-		if (count <= 0 || d == NULL)
-			break;
-		int sides = atoi(d + 1);
-		if (sides <= 0)
-			break;
-		total += count * (sides + 1) / 2;
-		const char *next = strchr(d, '/');
-		if (next == NULL)
-			break;
-		cursor = next + 1;
-	}
-	return total;
-}
-
 static int
 player_offense_score(void)
 {
-	const char *damage_str = player.t_stats.s_dmg;
+	const struct dice *dp = DICE(player.t_dice);
 	int base = 0;
 	int bonus = add_dam(pstats.s_str);
 
-	if (cur_weapon != NULL && cur_weapon->o_damage != NULL)
-		damage_str = cur_weapon->o_damage;
-	base = parse_average_damage(damage_str);
+	if (cur_weapon != NULL && DICE(cur_weapon->o_dice)->d_natt > 0)
+		dp = DICE(cur_weapon->o_dice);
+	base = dp->d_avg;
 	if (cur_weapon != NULL)
 		base += cur_weapon->o_dplus;
 	if (ISRING(LEFT, R_ADDDAM))
@@ -82,7 +61,7 @@ monster_offense_score(const THING *monster)
 {
 	if (monster == NULL)
 		return 0;
-	int base = parse_average_damage(monster->t_stats.s_dmg);
+	int base = DICE(monster->t_dice)->d_avg;
 	if (base < 1)
 		base = 1;
 	return base + monster->t_stats.s_lvl;
@@ -102,7 +81,11 @@ monster_defense_score(const THING *monster)
 static int
 player_power_score(void)
 {
-	return player_offense_score() * 4 + player_defense_score();
+	if (!power_valid) {
+		power_score = player_offense_score() * 4 + player_defense_score();
+		power_valid = TRUE;
+	}
+	return power_score;
 }
 
 static int
@@ -115,7 +98,7 @@ static threat_level_t
 assess_threat(const THING *monster)
 {
 	int player_score = max(player_power_score(), 1);
-	int monster_score = monster_power_score(monster);
+	int monster_score = monster->t_power;
 	int ratio;
 
 	if (monster_score <= 0)
@@ -232,11 +215,13 @@ fight(coord *mp, char mn, THING *weap, bool thrown)
 					discard(weap);
 				}
 				cur_weapon = NULL;
+				power_reset();
 			}
 		}
 		if (on(player, CANHUH)) {
 			did_huh = TRUE;
 			tp->t_flags |= ISHUH;
+			mt_sync(tp);
 			player.t_flags &= ~CANHUH;
 			msg("your hands stop glowing red");
 		}
@@ -351,6 +336,7 @@ attack(THING *mp)
 				pstats.s_hpt = 1;
 			if (max_hp < 1)
 				death(mp->t_type);
+			power_reset();
 			msg("you suddenly feel weaker");
 			}
 		when 'F':
@@ -358,7 +344,7 @@ attack(THING *mp)
 			 * Violet fungi stops the poor guy from moving
 			 */
 			player.t_flags |= ISHELD;
-			sprintf(mp->t_stats.s_dmg,"%dd1",++fung_hit);
+			f_grow();
 		when 'L':
 		{
 			/*
@@ -473,6 +459,7 @@ check_level(void)
 		max_hp += add;
 		if ((pstats.s_hpt += add) > max_hp)
 			pstats.s_hpt = max_hp;
+		power_reset();
 		msg("and achieve the rank of \"%s\"", he_man[i-1]);
 	}
 }
@@ -485,8 +472,8 @@ bool
 roll_em(THING *thatt, THING *thdef, THING *weap, bool hurl)
 {
 	register struct stats *att, *def;
-	char *cp;
-	int ndice, nsides, def_arm;
+	register struct dice *dp;
+	int i, def_arm;
 	register bool did_hit = FALSE;
 	register int hplus;
 	register int dplus;
@@ -495,7 +482,7 @@ roll_em(THING *thatt, THING *thdef, THING *weap, bool hurl)
 	def = &thdef->t_stats;
 	if (weap == NULL)
 	{
-		cp = att->s_dmg;
+		dp = DICE(thatt->t_dice);
 		dplus = 0;
 		hplus = 0;
 	}
@@ -522,11 +509,11 @@ roll_em(THING *thatt, THING *thdef, THING *weap, bool hurl)
 			else if (ISRING(RIGHT, R_ADDHIT))
 				hplus += cur_ring[RIGHT]->o_ac;
 		}
-		cp = weap->o_damage;
+		dp = DICE(weap->o_dice);
 		if (hurl && (weap->o_flags&ISMISL) && cur_weapon != NULL &&
 			  cur_weapon->o_which == weap->o_launch)
 		{
-			cp = weap->o_hurldmg;
+			dp = DICE(weap->o_hdice);
 			hplus += cur_weapon->o_hplus;
 			dplus += cur_weapon->o_dplus;
 		}
@@ -536,14 +523,16 @@ roll_em(THING *thatt, THING *thdef, THING *weap, bool hurl)
 		if (weap->o_type == STICK && weap->o_which == WS_HIT
 			&& --weap->o_charges < 0)
 		{
-			cp = weap->o_damage = "0d0";
+			dp = DICE(weap->o_dice = dice_id("0d0"));
 			weap->o_hplus = weap->o_dplus = 0;
 			weap->o_charges = 0;
+			if (weap == cur_weapon)
+				power_reset();
 		}
 	}
 
-	//@ New NULL check to prevent segfault on atoi()
-	if (cp == NULL)
+	//@ Something with no damage string has no attacks
+	if (dp->d_natt == 0)
 	{
 		return FALSE;
 	}
@@ -565,17 +554,13 @@ roll_em(THING *thatt, THING *thdef, THING *weap, bool hurl)
 			def_arm -= cur_ring[RIGHT]->o_ac;
 	}
 	int total_damage = 0;
-	for (;;)
+	for (i = 0; i < dp->d_natt; i++)
 	{
-		ndice = atoi(cp);
-		if ((cp = stpchr(cp, 'd')) == NULL)
-			break;
-		nsides = atoi(++cp);
 		if (swing(att->s_lvl, def_arm, hplus + str_plus(att->s_str)))
 		{
 			register int proll;
 
-			proll = roll(ndice, nsides);
+			proll = dice_roll(&dp->d_att[i]);
 			damage = dplus + proll + add_dam(att->s_str);
 			/*
 			 * special goodies for the commercial version of rogue
@@ -595,10 +580,9 @@ roll_em(THING *thatt, THING *thdef, THING *weap, bool hurl)
 			total_damage += applied;
 			did_hit = TRUE;
 		}
-		if ((cp = stpchr(cp, '/')) == NULL)
-			break;
-		cp++;
 	}
+	if (did_hit && EV_ON(EV_DAMAGE))
+		ev_damage(thatt, thdef, total_damage);
 	if (thatt == &player)
 		last_player_damage = total_damage;
 	if (thdef == &player)
@@ -656,7 +640,38 @@ hit(char *er, char *ee, THING *monster)
 		cur_standend();
 		// Teleporter Affix: Evasive
 		if (monster->t_affix == MA_TELEPORTER && rnd(100) < 25) {
-			rnd_pos(&rooms[rnd_room()], &monster->t_pos);
+			register int rm;
+			coord new_yx, from;
+
+			if (see_monst(monster) && EV_ON(EV_TILE))
+				ev_tile(monster->t_pos.y, monster->t_pos.x,
+				    monster->t_oldch, NULL, FALSE);
+			do {
+				rm = rnd_room();
+				new_yx = monster->t_pos;
+				rnd_pos(&rooms[rm], &new_yx);
+			} while (!isfloor(winat(new_yx.y, new_yx.x)));
+			from = monster->t_pos;
+			monster->t_pos = new_yx;
+			monster->t_room = room_id(&rooms[rm]);
+			if (monster->t_type == 'F')
+				player.t_flags &= ~ISHELD;
+			mt_sync(monster);
+			if (see_monst(monster)) {
+				monster->t_oldch = chat(new_yx.y, new_yx.x);
+				if (EV_ON(EV_TILE))
+					ev_tile(new_yx.y, new_yx.x,
+					    monster->t_disguise, monster, FALSE);
+			} else if (on(player, SEEMONST)) {
+				monster->t_oldch = cansee(new_yx.y, new_yx.x) ?
+				    chat(new_yx.y, new_yx.x) : ' ';
+				if (EV_ON(EV_TILE))
+					ev_tile(new_yx.y, new_yx.x,
+					    monster->t_disguise, monster, TRUE);
+			} else
+				monster->t_oldch = '@';
+			if (EV_ON(EV_MOVED))
+				ev_moved(monster, &from);
 			msg("The monster teleports away!");
 		}
 	} else if (monster && ee == NULL) { // Monster hitting player
@@ -770,6 +785,27 @@ add_dam(str_t str)
 	return add;
 }
 
+/*
+ * power_reset:
+ *	The player's weapon, rings, armor, strength or level changed, so
+ *	his power score has to be worked out again
+ */
+void
+power_reset(void)
+{
+	power_valid = FALSE;
+}
+
+/*
+ * power_monster:
+ *	Store a monster's power score, for when it is made or gets stronger
+ */
+void
+power_monster(THING *tp)
+{
+	tp->t_power = monster_power_score(tp);
+}
+
 threat_level_t
 monster_threat_level(const THING *monster)
 {
@@ -779,6 +815,9 @@ monster_threat_level(const THING *monster)
 void
 threat_apply_color(threat_level_t level)
 {
+	//@ on a slow link the [label] says it, without an attribute change each
+	if (slow_link)
+		return;
 	apply_threat_color(level);
 }
 
@@ -841,6 +880,8 @@ remove_monster(coord *mp, THING *tp, bool waskill)
 		mvaddch(mp->y, mp->x, tp->t_oldch);
 	standend();
 	detach(mlist, tp);
+	mt_del(tp);
+	dest_hero(tp);		/* lets go of what it was after */
 	discard(tp);
 }
 
@@ -0,0 +1,182 @@
+/*
+ * Field of view: what the hero can see, worked out once per move (in a
+ * maze by recursive shadowcasting) and kept as a bitmap of the screen
+ *
+ * fov.c
+ */
+
+#include "rogue.h"
+#include "curses.h"
+
+#define FOV_BIT(y,x)	((y) * MAXCOLS + (x))
+#define fov_set(y,x)	(fov_bits[FOV_BIT(y,x) >> 3] |= 1 << (FOV_BIT(y,x) & 7))
+#define fov_isset(y,x)	(fov_bits[FOV_BIT(y,x) >> 3] & (1 << (FOV_BIT(y,x) & 7)))
+
+static byte fov_bits[(MAXLINES * MAXCOLS + 7) / 8];
+
+/*
+ * The bitmap holds until the hero moves or changes room, his
+ * blindness changes or his room is lit.  Whoever does one of those
+ * calls fov_reset() and the next query works it out again.
+ */
+static bool fov_valid = FALSE;
+
+/*
+ * The lit area being cast into: the hero's room
+ */
+static int fov_top, fov_left, fov_bottom, fov_right, fov_radius;
+
+static void	fov_update(void);
+static bool	fov_opaque(int y, int x);
+static void	fov_cast(int row, double start, double end,
+			int xx, int xy, int yx, int yy);
+
+/*
+ * fov_reset:
+ *	Forget the bitmap, the hero's view has changed
+ */
+void
+fov_reset(void)
+{
+	fov_valid = FALSE;
+}
+
+/*
+ * fov_see:
+ *	Can the hero see (y, x)?
+ */
+bool
+fov_see(int y, int x)
+{
+	if (!fov_valid)
+		fov_update();
+	if (y < 0 || y >= MAXLINES || x < 0 || x >= MAXCOLS)
+		return FALSE;
+	return fov_isset(y, x) != 0;
+}
+
+/*
+ * fov_update:
+ *	Work out the bitmap for where the hero is now.  The hero's lamp
+ *	shows the squares next to him whatever they are; beyond that only
+ *	the lit room he is in can be seen.  An ordinary room is seen
+ *	whole, walls and all, even before he is through its door:
+ *	enter_room() asks while he still stands outside.  In a maze he
+ *	sees as far as the rock between the passages lets him.
+ */
+static
+void
+fov_update(void)
+{
+	register int y, x, i;
+	static int mult[4][8] = {
+		{ 1,  0,  0, -1, -1,  0,  0,  1 },
+		{ 0,  1, -1,  0,  0, -1,  1,  0 },
+		{ 0,  1,  1,  0,  0, -1, -1,  0 },
+		{ 1,  0,  0,  1, -1,  0,  0, -1 },
+	};
+
+	fov_valid = TRUE;
+	setmem(fov_bits, sizeof fov_bits, 0);
+	if (on(player, ISBLIND))
+		return;
+	for (y = hero.y - 1; y <= hero.y + 1; y++)
+		for (x = hero.x - 1; x <= hero.x + 1; x++)
+			if (y >= 0 && y < MAXLINES && x >= 0 && x < MAXCOLS
+			  && DISTANCE(y, x, hero.y, hero.x) < LAMPDIST)
+				fov_set(y, x);
+	if (proom == NULL || (proom->r_flags & ISDARK)
+	  || ((proom->r_flags & ISGONE) && !(proom->r_flags & ISMAZE)))
+		return;
+	fov_top = max(proom->r_pos.y, 0);
+	fov_left = max(proom->r_pos.x, 0);
+	fov_bottom = min(proom->r_pos.y + proom->r_max.y, MAXLINES) - 1;
+	fov_right = min(proom->r_pos.x + proom->r_max.x, MAXCOLS) - 1;
+	if (!(proom->r_flags & ISMAZE)) {
+		for (y = fov_top; y <= fov_bottom; y++)
+			for (x = fov_left; x <= fov_right; x++)
+				fov_set(y, x);
+		return;
+	}
+	fov_radius = max(max(hero.y - fov_top, fov_bottom - hero.y),
+		max(hero.x - fov_left, fov_right - hero.x));
+	if (hero.y >= fov_top && hero.y <= fov_bottom
+	  && hero.x >= fov_left && hero.x <= fov_right)
+		fov_set(hero.y, hero.x);
+	for (i = 0; i < 8; i++)
+		fov_cast(1, 1.0, 0.0, mult[0][i], mult[1][i], mult[2][i], mult[3][i]);
+}
+
+/*
+ * fov_opaque:
+ *	Does (y, x) stop the hero's sight in a maze?  Nothing outside it
+ *	can be seen, and the rock between the passages hides what's
+ *	behind it.
+ */
+static
+bool
+fov_opaque(int y, int x)
+{
+	if (y < fov_top || y > fov_bottom || x < fov_left || x > fov_right)
+		return TRUE;
+	switch (chat(y, x)) {
+	case ' ':
+	case VWALL:
+	case HWALL:
+	case ULWALL:
+	case URWALL:
+	case LLWALL:
+	case LRWALL:
+		return TRUE;
+	}
+	return FALSE;
+}
+
+/*
+ * fov_cast:
+ *	Light one octant, row by row outward from the hero, between the
+ *	slopes start and end.  An opaque square splits the scan: the part
+ *	beside it carries on in a recursive call and the part behind it is
+ *	in shadow.  (Bjorn Bergstrom's recursive shadowcasting.)
+ */
+static
+void
+fov_cast(int row, double start, double end, int xx, int xy, int yx, int yy)
+{
+	register int j, dx, dy, y, x;
+	double l_slope, r_slope, new_start;
+	bool blocked;
+
+	if (start < end)
+		return;
+	new_start = 0.0;
+	blocked = FALSE;
+	for (j = row; j <= fov_radius && !blocked; j++) {
+		dy = -j;
+		for (dx = -j; dx <= 0; dx++) {
+			x = hero.x + dx * xx + dy * xy;
+			y = hero.y + dx * yx + dy * yy;
+			l_slope = (dx - 0.5) / (dy + 0.5);
+			r_slope = (dx + 0.5) / (dy - 0.5);
+			if (start < r_slope)
+				continue;
+			if (end > l_slope)
+				break;
+			if (y >= fov_top && y <= fov_bottom
+			  && x >= fov_left && x <= fov_right)
+				fov_set(y, x);
+			if (blocked) {
+				if (fov_opaque(y, x)) {
+					new_start = r_slope;
+					continue;
+				}
+				blocked = FALSE;
+				start = new_start;
+			} else if (fov_opaque(y, x) && j < fov_radius) {
+				blocked = TRUE;
+				fov_cast(j + 1, start, l_slope, xx, xy, yx, yy);
+				new_start = r_slope;
+			}
+		}
+	}
+}
@@ -7,8 +7,7 @@
 #include "rogue.h"
 #include "curses.h"
 
-THING *_things;
-int   *_t_alloc;
+struct arena _arena[NARENA];	/* The THING pool, see list.c */
 
 /*
  * init_player:
@@ -19,12 +18,12 @@ init_player()
 {
 	register THING *obj;
 	bcopy(pstats,max_stats);
+	player.t_dice = dice_id(pstats.s_dmg);
 	food_left = HUNGERTIME;
 	/*
 	 * initialize things
 	 */
-	setmem(_things,MAXITEMS*sizeof(THING),0);
-	setmem(_t_alloc,MAXITEMS*sizeof(int),0);
+	t_reset();
 
 	switch (player_class) {
 	case C_WARRIOR:
@@ -32,7 +31,7 @@ init_player()
 		pstats.s_maxhp = 14;
 		pstats.s_hpt = 14;
 		// Ring Mail
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = ARMOR;
 		obj->o_which = RING_MAIL;
 		obj->o_ac = a_class[RING_MAIL];
@@ -42,7 +41,7 @@ init_player()
 		add_pack(obj, TRUE);
 		cur_armor = obj;
 		// Two-Handed Sword
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = WEAPON;
 		obj->o_which = TWOSWORD;
 		init_weapon(obj, TWOSWORD);
@@ -52,7 +51,7 @@ init_player()
 		add_pack(obj, TRUE);
 		cur_weapon = obj;
 		// 1 Ration
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = FOOD;
 		obj->o_count = 1;
 		obj->o_which = 0;
@@ -64,7 +63,7 @@ init_player()
 		pstats.s_maxhp = 12;
 		pstats.s_hpt = 12;
 		// Leather Armor
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = ARMOR;
 		obj->o_which = LEATHER;
 		obj->o_ac = a_class[LEATHER];
@@ -74,7 +73,7 @@ init_player()
 		add_pack(obj, TRUE);
 		cur_armor = obj;
 		// Short Bow
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = WEAPON;
 		obj->o_which = BOW;
 		init_weapon(obj, BOW);
@@ -84,7 +83,7 @@ init_player()
 		add_pack(obj, TRUE);
 		cur_weapon = obj;
 		// 40 Arrows
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = WEAPON;
 		obj->o_which = ARROW;
 		init_weapon(obj, ARROW);
@@ -93,7 +92,7 @@ init_player()
 		obj->o_group = 0;
 		add_pack(obj, TRUE);
 		// Dagger
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = WEAPON;
 		obj->o_which = DAGGER;
 		init_weapon(obj, DAGGER);
@@ -102,7 +101,7 @@ init_player()
 		obj->o_group = 0;
 		add_pack(obj, TRUE);
 		// 1 Ration
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = FOOD;
 		obj->o_count = 1;
 		obj->o_which = 0;
@@ -114,7 +113,7 @@ init_player()
 		pstats.s_maxhp = 10;
 		pstats.s_hpt = 10;
 		// Dagger
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = WEAPON;
 		obj->o_which = DAGGER;
 		init_weapon(obj, DAGGER);
@@ -124,7 +123,7 @@ init_player()
 		add_pack(obj, TRUE);
 		cur_weapon = obj;
 		// Wand of Magic Missile
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = STICK;
 		obj->o_which = WS_MISSILE;
 		fix_stick(obj);
@@ -134,7 +133,7 @@ init_player()
 		obj->o_group = 0;
 		add_pack(obj, TRUE);
 		// 2 Identify Scrolls
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = SCROLL;
 		obj->o_which = S_IDENT;
 		obj->o_flags |= ISKNOW;
@@ -142,7 +141,7 @@ init_player()
 		obj->o_group = 0;
 		add_pack(obj, TRUE);
 		// 1 Healing Potion
-		obj = new_item();
+		obj = game_item();
 		obj->o_type = POTION;
 		obj->o_which = P_HEALING;
 		obj->o_flags |= ISKNOW;
@@ -538,8 +537,8 @@ init_ds(void)
 	//@ data that is saved to and restored from saved game files:
 	_flags = (byte *) newmem((MAXLINES-3)*MAXCOLS);
 	_level = (byte *) newmem((MAXLINES-3)*MAXCOLS);
-	_things = (THING *)newmem(sizeof(THING) * MAXITEMS);
-	_t_alloc = (int *)newmem(MAXITEMS*sizeof(int));
+	//@ the THING arenas start empty and grow a block at a time, see talloc()
+	setmem(_arena, sizeof(_arena), 0);
 
 	//@ data discarded and re-created on new and restored games:
 	tbuf = newmem(MAXSTR);
@@ -558,8 +557,11 @@ free_ds()
 {
 	free(_flags);
 	free(_level);
-	free(_things);
-	free(_t_alloc);
+	t_free();
+	mt_free();
+	dice_free();
+	d_free();
+	ev_free();
 	free(tbuf);
 	free(msgbuf);
 	free(prbuf);
@@ -24,6 +24,8 @@ static int message_log_count = 0;
 static void message_log_store(const char *msg);
 static int message_log_slot(int index);
 static const char *message_log_get(int index);
+static void log_sink(struct event *ep, int n, void *arg);
+static void draw_sink(struct event *ep, int n, void *arg);
 
 /* VARARGS1 */
 /*@ nope, it was not vargars. But now it is */
@@ -112,7 +114,8 @@ endmsg(void)
 	 */
 	if (is_lower(msgbuf[0]) && msgbuf[1] != ')')
 		msgbuf[0] = toupper(msgbuf[0]);
-	message_log_store(msgbuf);
+	if (EV_ON(EV_MESSAGE))
+		ev_message(msgbuf);
 	putmsg(0,msgbuf);
 	mpos = newpos;
 	newpos = 0;
@@ -216,6 +219,59 @@ message_log_store(const char *msg)
 	message_log[slot][BUFSIZE - 1] = '\0';
 }
 
+/*
+ * io_sinks:
+ *	Plug the screen and the message log into the game events.  Both
+ *	take a turn's worth at a time.
+ */
+void
+io_sinks(void)
+{
+	ev_sink(EV_BIT(EV_TILE), FALSE, draw_sink, NULL);
+	ev_sink(EV_BIT(EV_MESSAGE), FALSE, log_sink, NULL);
+}
+
+/*
+ * draw_sink:
+ *	Put the turn's changed squares on the screen, in the order they
+ *	changed.  A monster that has died or moved on since it was posted
+ *	is not drawn, and the hero's square is left to look().
+ */
+static void
+draw_sink(struct event *ep, int n, void *arg)
+{
+	register THING *tp;
+
+	(void) arg;	//@ no payload
+	for (; n--; ep++) {
+		if (ep->ev_type != EV_TILE)
+			continue;
+		if (ep->ev_pos.y == hero.y && ep->ev_pos.x == hero.x)
+			continue;
+		if (ep->ev_who >= 0 && ((tp = moat(ep->ev_pos.y, ep->ev_pos.x))
+		  == NULL || tp->l_id != ep->ev_who))
+			continue;
+		if (ep->ev_amount)
+			standout();
+		mvaddch(ep->ev_pos.y, ep->ev_pos.x, ep->ev_ch);
+		if (ep->ev_amount)
+			standend();
+	}
+}
+
+/*
+ * log_sink:
+ *	Keep the turn's messages for show_message_log()
+ */
+static void
+log_sink(struct event *ep, int n, void *arg)
+{
+	(void) arg;	//@ no payload
+	for (; n--; ep++)
+		if (ep->ev_type == EV_MESSAGE)
+			message_log_store(ev_text(ep));
+}
+
 static int
 message_log_slot(int index)
 {
@@ -272,11 +328,13 @@ putmsg(msgline,msg)
 void
 show_message_log(void)
 {
-	int total = message_log_count;
+	int total;
 	int top;
 	int lines_per_page;
 	bool done = FALSE;
 
+	ev_flush();		/* this turn's messages aren't in the log yet */
+	total = message_log_count;
 	wdump();
 	clear();
 
@@ -546,6 +604,7 @@ str_attr(str)
 #ifdef LUXURY
 	register int is_attr_on = FALSE, was_touched = FALSE;
 
+	cur_span();
 	while(*str)
 	{
 		if (was_touched == TRUE)
@@ -583,23 +642,26 @@ str_attr(str)
 		if ((*str == '\n') || (*str == '\r'))
 		{
 			str++;
-			printw("\n");
+			cur_spanch('\n');
 		}
 		else if (*str != 0)
-			addch(*str++);
+			cur_spanch(*str++);
 	}
+	cur_spanend();
 	if (is_attr_on)
 		standend();
 #else
+	cur_span();
 	while (*str)
 	{
 		if (*str == '%') {
 			str++;
 			standout();
 		}
-		addch(*str++);
+		cur_spanch(*str++);
 		standend();
 	}
+	cur_spanend();
 #endif //LUXURY
 }
 
@@ -745,7 +807,9 @@ SIG2(void)
 		show_count();
 		running = FALSE;
 		move(24,nspot);
-		if (numl)
+		if (slow_link)
+			;  //@ the LEDs are only cosmetic, not worth the bytes
+		else if (numl)
 		{
 			bold();
 			addstr("NUM LOCK");
@@ -758,7 +822,9 @@ SIG2(void)
 	{
 		capsl = new_capsl;
 		move(24,cspot);
-		if (capsl)
+		if (slow_link)
+			;
+		else if (capsl)
 		{
 			bold();
 			addstr("CAP LOCK");
@@ -780,10 +846,13 @@ SIG2(void)
 #endif //DEMO
 		/* work around the compiler buggie boos */
 		spare = littlehand % 10;
-		move(24,tspot);
-		bold();
-		printw("%2d:%1d%1d",bighand?bighand:12,littlehand/10,spare);
-		standend();
+		if (!slow_link)  //@ nor is the clock
+		{
+			move(24,tspot);
+			bold();
+			printw("%2d:%1d%1d",bighand?bighand:12,littlehand/10,spare);
+			standend();
+		}
 	}
 	move(x, y);
 }
@@ -9,7 +9,10 @@
 #include "rogue.h"
 #include "curses.h"
 
-static void	*talloc(void);
+static void	*talloc(int a);
+static int	t_grow(int a);
+static THING	*t_move(THING *item, int a);
+static void	t_empty(int a);
 
 /*
  * detach:
@@ -69,64 +72,323 @@ list_free(ptr)
 
 /*
  * new_item
- *	Get a new item with a specified size
+ *	Get a new item with a specified size.  It belongs to the level
+ *	and is thrown away with it, unless the hero takes it.
  */
 THING *
 new_item()
 {
 	register THING *item;
 #ifdef DEBUG
-	if ((item = (THING *) talloc()) == NULL)
+	if ((item = (THING *) talloc(A_LEVEL)) == NULL)
 		if (me())msg("no more things!");
 	else
 #else
-	if ((item = (THING *) talloc()) != NULL)
+	if ((item = (THING *) talloc(A_LEVEL)) != NULL)
 #endif //DEBUG
 			 item->l_next = item->l_prev = NULL;
 	return item;
 }
 
+/*
+ * game_item:
+ *	Get a new item that goes straight into the hero's pack
+ */
+THING *
+game_item()
+{
+	register THING *item;
+
+	item = (THING *) talloc(A_GAME);
+	item->l_next = item->l_prev = NULL;
+	return item;
+}
+
+/*
+ * A THING's l_id is its arena and its index there, which is
+ * block * THINGBLK + place in block.
+ */
+#define T_ID(a,i)	((i) << 1 | (a))
+#define T_ARENA(id)	((id) & 1)
+#define T_INDEX(id)	((id) >> 1)
+
+#define t_at(ap,i)	(&(ap)->a_blk[(i) / THINGBLK][(i) % THINGBLK])
+#define t_genof(ap,i)	((ap)->a_gen[(i) / THINGBLK][(i) % THINGBLK])
+
+/*
+ * t_grow:
+ *	Add another block of THINGBLK things to an arena.  Blocks are never
+ *	moved or freed during a game, so a THING pointer stays valid for as
+ *	long as the thing is in use; only the block tables get reallocated.
+ */
+static
+int
+t_grow(int a)
+{
+	register struct arena *ap;
+	THING **nblk;
+	int **ngen, *nfree;
+
+	ap = &_arena[a];
+	nblk = (THING **) newmem((ap->a_nblk + 1) * sizeof(THING *));
+	ngen = (int **) newmem((ap->a_nblk + 1) * sizeof(int *));
+	nfree = (int *) newmem((ap->a_nblk + 1) * THINGBLK * sizeof(int));
+	if (ap->a_nblk > 0)
+	{
+		memcpy(nblk, ap->a_blk, ap->a_nblk * sizeof(THING *));
+		memcpy(ngen, ap->a_gen, ap->a_nblk * sizeof(int *));
+		memcpy(nfree, ap->a_free, ap->a_nfree * sizeof(int));
+	}
+	free(ap->a_blk);
+	free(ap->a_gen);
+	free(ap->a_free);
+	ap->a_blk = nblk;
+	ap->a_gen = ngen;
+	ap->a_free = nfree;
+	ap->a_blk[ap->a_nblk] = (THING *) newmem(THINGBLK * sizeof(THING));
+	ap->a_gen[ap->a_nblk] = (int *) newmem(THINGBLK * sizeof(int));
+	setmem(ap->a_gen[ap->a_nblk], THINGBLK * sizeof(int), 0);
+	return ap->a_nblk++;
+}
+
 /*
  * talloc: simple allocation of a THING
+ *	@ the arena grows by a block when it is full, so this never fails.
+ *	A thing given back is handed out again first; after that the
+ *	arena goes on from where it was last reset.
  */
 static
 void *  //@ maybe should be THING*, as this is a specialized malloc()
-talloc()
+talloc(int a)
 {
+	register struct arena *ap;
+	register THING *item;
 	register int i;
 
-	for (i=0;i<MAXITEMS;i++)
+	ap = &_arena[a];
+	if (ap->a_nfree > 0)
+		i = ap->a_free[--ap->a_nfree];
+	else
 	{
-		if (_t_alloc[i] == 0)
-		{
-			if (++total > maxitems)
-			maxitems = total;
-			_t_alloc[i]++;
-			setmem(&_things[i],sizeof(THING),0);
-			return &_things[i];
-		}
+		if (ap->a_next == ap->a_nblk * THINGBLK)
+			t_grow(a);
+		i = ap->a_next++;
 	}
-	return NULL;
+	ap->a_inuse++;
+	if (++total > maxitems)
+		maxitems = total;
+	/*
+	 * Make the generation odd, and new even if the arena was reset
+	 * while the thing was in use
+	 */
+	t_genof(ap, i) += (t_genof(ap, i) & 1) ? 2 : 1;
+	item = t_at(ap, i);
+	setmem(item, sizeof(THING), 0);
+	item->l_id = T_ID(a, i);
+	return item;
+}
+
+/*
+ * t_inuse:
+ *	Is an item a THING in use in its arena?
+ */
+bool
+t_inuse(THING *item)
+{
+	register struct arena *ap;
+	register int i;
+
+	if (item->l_id < 0)
+		return FALSE;
+	ap = &_arena[T_ARENA(item->l_id)];
+	i = T_INDEX(item->l_id);
+	return i < ap->a_next && t_at(ap, i) == item && (t_genof(ap, i) & 1);
 }
 
 /*
  * discard:
- *	Free up an item
+ *	Free up an item.  Returns 0 if it isn't a THING in use, which
+ *	catches a thing being thrown away twice.
  */
 int
 discard(item)
 	register THING *item;
 {
+	register struct arena *ap;
 	register int i;
 
-	for (i=0;i<MAXITEMS;i++)
+	if (!t_inuse(item))
+	{
+#ifdef DEBUG
+		debug("discard: not a thing in use");
+#endif //DEBUG
+		return 0;
+	}
+	ap = &_arena[T_ARENA(item->l_id)];
+	i = T_INDEX(item->l_id);
+	--total;
+	ap->a_inuse--;
+	t_genof(ap, i)++;
+	ap->a_free[ap->a_nfree++] = i;
+	return 1;
+}
+
+/*
+ * t_copy:
+ *	Make dest a copy of source.  dest keeps its own place in the pool.
+ */
+void
+t_copy(dest, source)
+	register THING *dest, *source;
+{
+	register int id;
+
+	id = dest->l_id;
+	bcopy(*dest, *source);
+	dest->l_id = id;
+}
+
+/*
+ * t_move:
+ *	Move an item that isn't in any list to another arena.  It gets a
+ *	new address, which is returned.
+ */
+static
+THING *
+t_move(THING *item, int a)
+{
+	register THING *nitem;
+
+	if (T_ARENA(item->l_id) == a)
+		return item;
+	nitem = (THING *) talloc(a);
+	t_copy(nitem, item);
+	discard(item);
+	return nitem;
+}
+
+/*
+ * t_promote, t_demote:
+ *	An item goes into the hero's pack, or out of it onto the level
+ */
+THING *
+t_promote(THING *item)
+{
+	return t_move(item, A_GAME);
+}
+
+THING *
+t_demote(THING *item)
+{
+	return t_move(item, A_LEVEL);
+}
+
+/*
+ * t_gen:
+ *	The generation of the slot an item is in.  It goes up every time
+ *	the slot is handed out or given back, and is odd while in use.
+ */
+int
+t_gen(item)
+	register THING *item;
+{
+	return t_genof(&_arena[T_ARENA(item->l_id)], T_INDEX(item->l_id));
+}
+
+/*
+ * t_handle:
+ *	The thing an l_id and generation were taken from, or NULL if it
+ *	has gone since
+ */
+THING *
+t_handle(id, gen)
+	int id, gen;
+{
+	register struct arena *ap;
+	register int i;
+
+	if (id < 0 || !(gen & 1))
+		return NULL;
+	ap = &_arena[T_ARENA(id)];
+	i = T_INDEX(id);
+	if (i >= ap->a_next || t_genof(ap, i) != gen)
+		return NULL;
+	return t_at(ap, i);
+}
+
+/*
+ * t_live:
+ *	Is a pointer saved with its generation still the same thing?
+ */
+bool
+t_live(item, gen)
+	register THING *item;
+	int gen;
+{
+	return item != NULL && t_inuse(item) && t_gen(item) == gen;
+}
+
+/*
+ * t_level:
+ *	Throw away everything on the level, its monsters, what they carry
+ *	and what lies about, in one go.  Generations aren't touched; a
+ *	stale pointer shows up because its slot is past the arena's end
+ *	until it's handed out again, with a new generation.
+ */
+void
+t_level()
+{
+	t_empty(A_LEVEL);
+}
+
+/*
+ * t_reset:
+ *	Mark every THING in both arenas as free, for a new game
+ */
+void
+t_reset()
+{
+	t_empty(A_LEVEL);
+	t_empty(A_GAME);
+}
+
+/*
+ * t_empty:
+ *	Mark every THING in an arena as free
+ */
+static
+void
+t_empty(int a)
+{
+	register struct arena *ap;
+
+	ap = &_arena[a];
+	total -= ap->a_inuse;
+	ap->a_inuse = 0;
+	ap->a_next = 0;
+	ap->a_nfree = 0;
+}
+
+/*
+ * t_free:
+ *	Give both arenas back
+ */
+void
+t_free()
+{
+	register struct arena *ap;
+	register int b;
+
+	for (ap = _arena; ap < &_arena[NARENA]; ap++)
 	{
-		if (item == &_things[i])
+		for (b = 0; b < ap->a_nblk; b++)
 		{
-			--total;
-			_t_alloc[i] = 0;
-			return 1;
+			free(ap->a_blk[b]);
+			free(ap->a_gen[b]);
 		}
+		free(ap->a_blk);
+		free(ap->a_gen);
+		free(ap->a_free);
 	}
-	return 0;
+	setmem(_arena, sizeof(_arena), 0);
 }
@@ -59,6 +59,15 @@ int current_drive = ROGUE_CURRENT_DRIVE;  //@ current fake drive (A=0, B=1, ...)
 int last_drive = ROGUE_LAST_DRIVE;  //@ last available drive
 #endif
 
+int frame_ms = 50;		/* Least time between frames, env file "frame" */
+static long frame_last;		/* md_nsec() when the last one was shown */
+static long link_base;		/* md_wbytes() at the end of the first turn */
+static long link_mark;		/* and of the last one */
+static long link_last, link_most;	/* Bytes the last and worst turn took */
+static long link_turns;		/* Turns counted */
+
+static void	link_report(void);
+
 
 byte swap_bits(
 	byte data,
@@ -512,6 +521,39 @@ md_nanosleep(long nanoseconds)
 	nanosleep(&ts, NULL);
 }
 
+/*@
+ * A monotonic clock in nanoseconds, for timing the daemons
+ */
+long
+md_nsec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+/*@
+ * Bytes the game has written so far, -1 if that can not be known.  Bar a
+ * save or score file now and then, all of it went to the terminal
+ */
+long
+md_wbytes(void)
+{
+	FILE *io;
+	char line[40];
+	long nb = -1;
+
+	//@ opened each time, a rewind() may be served from the old buffer
+	if ((io = fopen("/proc/self/io", "r")) == NULL)
+		return -1;
+	while (fgets(line, sizeof(line), io) != NULL)
+		if (sscanf(line, "wchar: %ld", &nb) == 1)
+			break;
+	fclose(io);
+	return nb;
+}
+
 
 /*@
  * Renamed from srand() to avoid collision with <stdlib.h>
@@ -691,7 +733,7 @@ readchar()
 
 	if (*typebuf) {
 		SIG2();
-		cur_refresh();  //@ macros
+		show_frame(FALSE);  //@ macros
 		return(*typebuf++);
 	}
 
@@ -704,7 +746,7 @@ readchar()
 	if (graphics_enabled) {
 		/* SDL blocking input - pumps events internally */
 		SIG2();
-		cur_refresh();
+		show_frame(TRUE);
 		xch = graphics_read_key();
 		ch = xlate_ch(xch);
 		if (ch == ESCAPE)
@@ -721,7 +763,7 @@ readchar()
 	do
 	{
 		SIG2();  /* Rogue spends a lot of time here @ you bet! */
-		cur_refresh();  //@ command input
+		show_frame(TRUE);  //@ command input
 	}
 	while ((xch = getch_timeout(250)) == NOCHAR);
 	
@@ -732,6 +774,68 @@ readchar()
 }
 
 
+/*
+ * show_frame:
+ *	Put what has been drawn on the terminal.  If now is set the
+ *	player is about to be asked for a key, or is watching something
+ *	move, and it goes out at once.  Otherwise a turn went by without
+ *	him: it is shown at most once every frame_ms, and not at all while
+ *	the game fast-forwards through a run, a repeat count or a macro,
+ *	whose end will show the screen as it came out.
+ */
+void
+show_frame(bool now)
+{
+	register long ns;
+
+	if (!now && (running || count > 0 || *typebuf))
+		return;
+	ns = md_nsec();
+	if (!now && ns - frame_last < frame_ms * 1000000L)
+		return;
+	frame_last = ns;
+	if (!is_saved)
+		ev_flush();  //@ what the turn has drawn so far goes out with it
+	cur_refresh();
+}
+
+/*
+ * link_turn:
+ *	A turn is over, see how many bytes went to the terminal in it.
+ *	Only counted on a slow link
+ */
+void
+link_turn(void)
+{
+	register long nb;
+
+	if (!slow_link || (nb = md_wbytes()) < 0)
+		return;
+	if (link_turns++ == 0)
+		link_base = nb;  //@ the title screen and the first level
+	else
+		link_last = nb - link_mark;
+	link_mark = nb;
+	if (link_last > link_most)
+		link_most = link_last;
+}
+
+/*
+ * link_report:
+ *	Say what the game cost the link, once the screen is closed
+ */
+static
+void
+link_report(void)
+{
+	if (link_turns < 2)
+		return;
+	printf("Sent %ld bytes to the terminal in %ld turns:"
+	  " %ld a turn, %ld at most, %ld the last\n",
+	  link_mark - link_base, link_turns - 1,
+	  (link_mark - link_base) / (link_turns - 1), link_most, link_last);
+}
+
 int
 bdos(fnum, dxval)
 	int fnum, dxval;
@@ -964,6 +1068,10 @@ void md_exit(int status)
 	(*cls_)();
 #endif
 	cur_endwin();
+	link_report();
+	//@ what the daemons cost, for whoever is tuning them
+	if (getenv("ROGUE_DAEMONS") != NULL)
+		d_print();
 	unsetup();
 	free_ds();
 #ifdef ROGUE_DEBUG
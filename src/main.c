@@ -32,6 +32,7 @@ int log_read, log_write;
 extern int graphics_enabled;
 #endif
 
+#ifndef ROGUE_SIM
 /*
  * main:
  *	The main program, of course
@@ -74,6 +75,18 @@ main(argc, argv)
 	 */
 	if (strncmp(s_screen, "bw", 2) == 0)
 		bwflag = TRUE;
+	/*@
+	 * "frame" is the least number of milliseconds between two screen
+	 * updates that do not wait for a key. See show_frame()
+	 */
+	if ((frame_ms = atoi(s_frame)) < 0)
+		frame_ms = 0;
+	/*@
+	 * "link" is "slow" for a player on a remote terminal that has to
+	 * save bytes. See slow_link
+	 */
+	if (strcmp(s_link, "slow") == 0)
+		slow_link = TRUE;
 #ifdef ROGUE_DOS_CURSES
 	int sl;
 	if ((sl = strlen(s_screen)) >= 4
@@ -94,6 +107,9 @@ main(argc, argv)
 				case 'R': case 'r':
 					 savfile = s_save;
 					 break;
+				case 'h': case 'H':
+					horde = TRUE;
+					break;
 				case 's': case 'S':
 					noscore = TRUE;
 					is_saved = TRUE;
@@ -121,6 +137,7 @@ main(argc, argv)
 		else if (savfile == 0)
 			savfile = curarg;
 	}
+	io_sinks();				/* Plug the screen into the events */
 	if (savfile == 0) {
 		savfile = 0;
 		winit();
@@ -181,16 +198,17 @@ main(argc, argv)
 		/*
 		 * Start up daemons and fuses
 		 */
-		start_daemon(doctor);
+		start_daemon("doctor", DP_HERO, 1, doctor, NULL);
 		fuse(swander, WANDERTIME);
-		start_daemon(stomach);
-		start_daemon(runners);
+		start_daemon("stomach", DP_HERO, 1, stomach, NULL);
+		start_daemon("runners", DP_MONST, 1, runners, NULL);
 		msg("Hello %s%s.", whoami, noterse(".  Welcome to the Dungeons of Doom"));
 		raise_curtain();
 	}
 	playit(savfile);
 	return 0;
 }
+#endif //ROGUE_SIM
 
 /*
  * endit:
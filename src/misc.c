@@ -152,7 +152,8 @@ look(bool wakeup)
 				threat_apply_color(monster_threat_level(tp));
 				threat_colored = TRUE;
 			}
-			if (!threat_colored && (ch!=PASSAGE) && (*fp & (F_PASS | F_MAZE)))
+			if (!threat_colored && !slow_link
+			  && (ch!=PASSAGE) && (*fp & (F_PASS | F_MAZE)))
 				/*
 				 * The current character used for IBM ARMOR doesn't
 				 * look right in Inverse
@@ -291,8 +292,10 @@ eat()
 	if ((food_left += HUNGERTIME - 200 + rnd(400)) > STOMACHSIZE)
 		food_left = STOMACHSIZE;
 	hungry_state = 0;
-	if (obj == cur_weapon)
+	if (obj == cur_weapon) {
 		cur_weapon = NULL;
+		power_reset();
+	}
 	if (obj->o_which == 1)
 		msg("my, that was a yummy %s", fruit);
 	else
@@ -329,6 +332,7 @@ chg_str(amt)
 		add_str(&comp, -cur_ring[RIGHT]->o_ac);
 	if (comp > max_stats.s_str)
 		max_stats.s_str = comp;
+	power_reset();
 }
 
 /*
@@ -510,8 +514,10 @@ call_it(bool know, char **guess)
 	else if (!know && **guess == '\0') {
 		msg("%scall it? ",noterse("what do you want to "));
 		getinfo(prbuf,MAXNAME);
-		if (*prbuf != ESCAPE)
+		if (*prbuf != ESCAPE) {
 			strcpy(*guess, prbuf);
+			name_dirty();
+		}
 		msg("");
 	}
 }
@@ -847,8 +853,10 @@ call()
 	msg("Was called \"%s\"", elsewise);
 	msg("what do you want to call it? ");
 	getinfo(prbuf,MAXNAME);
-	if (*prbuf && *prbuf != ESCAPE)
+	if (*prbuf && *prbuf != ESCAPE) {
 		strcpy(guess[obj->o_which], prbuf);
+		name_dirty();
+	}
 	msg("");
 }
 
@@ -8,6 +8,7 @@
 #include "curses.h"
 
 static int	exp_add(THING *tp);
+static void	f_compile(void);
 
 /*
  * List of monsters in rough order of vorpalness
@@ -71,7 +72,7 @@ new_monster(THING *tp, byte type, coord *cp)
 	tp->t_disguise = type;
 	bcopy(tp->t_pos,*cp);
 	tp->t_oldch = '@';
-	tp->t_room = roomin(cp);
+	tp->t_room = room_id(roomin(cp));
 	mp = &monsters[tp->t_type-'A'];
 	int base_level = mp->m_stats.s_lvl + lev_add;
 	int player_level = max(1, pstats.s_lvl);
@@ -98,7 +99,6 @@ new_monster(THING *tp, byte type, coord *cp)
 	tp->t_stats.s_str = mp->m_stats.s_str;
 	tp->t_stats.s_exp = mp->m_stats.s_exp + level_bonus * 10 + exp_add(tp);
 	tp->t_flags = mp->m_flags;
-	tp->t_turn = TRUE;
 	tp->t_pack = NULL;
 
 	if (is_boss) {
@@ -109,10 +109,12 @@ new_monster(THING *tp, byte type, coord *cp)
 		tp->t_flags |= ISMEAN;
 		tp->t_affix = rnd(3) + 1;      // 1-3: Vampiric, Thorns, Teleporter
 	}
+	mt_add(tp);
 	if (ISWEARING(R_AGGR))
 		start_run(cp);
 	if (type == 'F')
 		tp->t_stats.s_dmg = f_damage;
+	tp->t_dice = dice_id(tp->t_stats.s_dmg);
 	if (type == 'X')
 	{
 		switch (rnd(level > 25 ? 9 : 8))
@@ -129,6 +131,24 @@ new_monster(THING *tp, byte type, coord *cp)
 		break;
 		}
 	}
+	power_monster(tp);
+}
+
+/*
+ * legendary:
+ *	Make a monster into a legendary boss
+ */
+void
+legendary(THING *tp)
+{
+	tp->t_rarity = LEGENDARY;
+	tp->t_stats.s_maxhp *= 3;
+	tp->t_stats.s_hpt = tp->t_stats.s_maxhp;
+	tp->t_stats.s_str += 5;
+	tp->t_stats.s_exp *= 5;
+	tp->t_flags |= ISMEAN;
+	mt_sync(tp);
+	power_monster(tp);
 }
 
 /*
@@ -141,6 +161,36 @@ f_restor(void)
 
 	fung_hit = 0;
 	strcpy(f_damage, mp->m_stats.s_dmg);
+	f_compile();
+}
+
+/*
+ * f_grow:
+ *	A flytrap has hit again, and holds on harder
+ */
+void
+f_grow(void)
+{
+	sprintf(f_damage, "%dd1", ++fung_hit);
+	f_compile();
+}
+
+/*
+ * f_compile:
+ *	All the flytraps share f_damage, so compile it again for each and
+ *	score its power again with the new damage
+ */
+static
+void
+f_compile(void)
+{
+	register THING *tp;
+
+	for (tp = mlist; tp != NULL; tp = next(tp))
+		if (tp->t_type == 'F') {
+			tp->t_dice = dice_id(f_damage);
+			power_monster(tp);
+		}
 }
 
 /*
@@ -221,8 +271,9 @@ wake_monster(y, x)
 	if (!on(*tp, ISRUN) && rnd(3) != 0 && on(*tp, ISMEAN) && !on(*tp, ISHELD)
 		&& !ISWEARING(R_STEALTH))
 	{
-		tp->t_dest = &hero;
+		dest_hero(tp);
 		tp->t_flags |= ISRUN;
+		mt_sync(tp);
 	}
 	if (ch == 'M' && !on(player, ISBLIND) && !on(*tp, ISFOUND)
 		&& !on(*tp, ISCANC) && on(*tp, ISRUN))
@@ -231,6 +282,7 @@ wake_monster(y, x)
 		dst = DISTANCE(y, x, hero.y, hero.x);
 		if ((rp != NULL && !(rp->r_flags & ISDARK)) || dst < LAMPDIST) {
 			tp->t_flags |= ISFOUND;
+			mt_sync(tp);
 			if (!save(VS_MAGIC)) {
 				if (on(player, ISHUH))
 					lengthen(unconfuse, rnd(20) + HUHDURATION);
@@ -246,10 +298,11 @@ wake_monster(y, x)
 	 */
 	if (on(*tp, ISGREED) && !on(*tp, ISRUN)) {
 		tp->t_flags = tp->t_flags | ISRUN;
+		mt_sync(tp);
 		if (proom->r_goldval)
-			tp->t_dest = &proom->r_gold;
+			dest_gold(tp, proom);
 		else
-			tp->t_dest = &hero;
+			dest_hero(tp);
 	}
 	return tp;
 }
@@ -299,10 +352,5 @@ THING *
 moat(my,mx)
 	int my, mx;
 {
-	register THING *tp;
-
-	for (tp = mlist ; tp != NULL ; tp = next(tp))
-		if (tp->t_pos.x == mx  && tp->t_pos.y == my)
-			return(tp);
-	return(NULL);
+	return mt_at(my, mx);
 }
@@ -183,6 +183,7 @@ move_stuff:
 			if ((fl & F_MAZE) && (flat(oldpos.y, oldpos.x) & F_MAZE) == 0)
 				enter_room(&nh);
 			bcopy(hero,nh);
+			fov_reset();
 		}
 		break;
 	}
@@ -0,0 +1,221 @@
+/*
+ * Packed monster table: the per-level monster state runners() sweeps
+ * every turn, kept in parallel arrays instead of scattered THINGs
+ *
+ * mtable.c
+ */
+
+#include "rogue.h"
+#include "curses.h"
+
+struct mtable mtab;
+
+static int	mt_slot(THING *tp);
+static void	mt_pack(void);
+static void	mt_grow(void);
+static void	*mt_renew(void *old, int nold, int nnew, int size);
+
+/*
+ * mt_slot:
+ *	Find the row of a monster, or -1 if it isn't in the table
+ */
+static
+int
+mt_slot(THING *tp)
+{
+	register int slot;
+
+	slot = tp->t_slot;
+	if (slot < 0 || slot >= mtab.mt_count || mtab.mt_thing[slot] != tp)
+		return -1;
+	return slot;
+}
+
+/*
+ * mt_pack:
+ *	Squeeze out rows left behind by dead monsters, keeping the order
+ */
+static
+void
+mt_pack(void)
+{
+	register int i, j;
+
+	for (i = j = 0; i < mtab.mt_count; i++) {
+		if (mtab.mt_thing[i] == NULL)
+			continue;
+		if (i != j) {
+			mtab.mt_thing[j] = mtab.mt_thing[i];
+			mtab.mt_y[j] = mtab.mt_y[i];
+			mtab.mt_x[j] = mtab.mt_x[i];
+			mtab.mt_flags[j] = mtab.mt_flags[i];
+			mtab.mt_type[j] = mtab.mt_type[i];
+			mtab.mt_qpos[j] = mtab.mt_qpos[i];
+			mtab.mt_thing[j]->t_slot = j;
+		}
+		j++;
+	}
+	mtab.mt_count = j;
+}
+
+/*
+ * mt_renew:
+ *	Move one column of the table into a bigger array
+ */
+static
+void *
+mt_renew(void *old, int nold, int nnew, int size)
+{
+	void *new;
+
+	new = newmem(nnew * size);
+	if (nold > 0)
+		memcpy(new, old, nold * size);
+	free(old);
+	return new;
+}
+
+/*
+ * mt_grow:
+ *	Double the rows in the table.  Only the columns move; THINGs
+ *	don't, so it's safe even in the middle of a sweep.
+ */
+static
+void
+mt_grow(void)
+{
+	register int nsize;
+
+	nsize = mtab.mt_size ? mtab.mt_size * 2 : MAXITEMS;
+	mtab.mt_thing = mt_renew(mtab.mt_thing, mtab.mt_count, nsize, sizeof(THING *));
+	mtab.mt_y = mt_renew(mtab.mt_y, mtab.mt_count, nsize, sizeof(shint));
+	mtab.mt_x = mt_renew(mtab.mt_x, mtab.mt_count, nsize, sizeof(shint));
+	mtab.mt_flags = mt_renew(mtab.mt_flags, mtab.mt_count, nsize, sizeof(short));
+	mtab.mt_type = mt_renew(mtab.mt_type, mtab.mt_count, nsize, sizeof(char));
+	mtab.mt_qpos = mt_renew(mtab.mt_qpos, mtab.mt_count, nsize, sizeof(int));
+	mtab.mt_size = nsize;
+}
+
+/*
+ * mt_add:
+ *	Give a monster the newest row in the table.  A monster that is
+ *	already in the table (polymorph) is moved to the end.
+ */
+void
+mt_add(THING *tp)
+{
+	register int slot;
+
+	mt_del(tp);
+	if (mtab.mt_count >= mtab.mt_size)
+		mt_grow();
+	slot = mtab.mt_count++;
+	mtab.mt_thing[slot] = tp;
+	mtab.mt_qpos[slot] = -1;
+	tp->t_slot = slot;
+	mt_sync(tp);
+}
+
+/*
+ * mt_del:
+ *	Take a monster out of the table.  While runners() is sweeping
+ *	the row is only blanked so the sweep index stays valid.
+ */
+void
+mt_del(THING *tp)
+{
+	register int slot;
+
+	if ((slot = mt_slot(tp)) < 0)
+		return;
+	sched_del(tp);
+	mtab.mt_thing[slot] = NULL;
+	mtab.mt_flags[slot] = 0;
+	if (!mtab.mt_sweep)
+		mt_pack();
+}
+
+/*
+ * mt_sync:
+ *	Copy the state of a monster that has just changed into its row.
+ *	This also keeps the scheduler's queue the set of active runners:
+ *	a monster that has started running is queued for its first move,
+ *	and one that was put to sleep or held leaves the queue.
+ */
+void
+mt_sync(THING *tp)
+{
+	register int slot;
+
+	if ((slot = mt_slot(tp)) < 0)
+		return;
+	mtab.mt_y[slot] = tp->t_pos.y;
+	mtab.mt_x[slot] = tp->t_pos.x;
+	mtab.mt_flags[slot] = tp->t_flags;
+	mtab.mt_type[slot] = tp->t_type;
+	if ((tp->t_flags & (ISHELD|ISRUN)) == ISRUN)
+		sched_add(tp);
+	else
+		sched_del(tp);
+}
+
+/*
+ * mt_clear:
+ *	Forget all the monsters on the level
+ */
+void
+mt_clear(void)
+{
+	mtab.mt_count = 0;
+	mtab.mt_sweep = FALSE;
+	sched_clear();
+}
+
+/*
+ * mt_free:
+ *	Give back the memory of the table
+ */
+void
+mt_free(void)
+{
+	free(mtab.mt_thing);
+	free(mtab.mt_y);
+	free(mtab.mt_x);
+	free(mtab.mt_flags);
+	free(mtab.mt_type);
+	free(mtab.mt_qpos);
+	setmem(&mtab, sizeof(mtab), 0);
+	sched_free();
+}
+
+/*
+ * mt_begin, mt_end:
+ *	Bracket a sweep of the table in which monsters may die
+ */
+void
+mt_begin(void)
+{
+	mtab.mt_sweep = TRUE;
+}
+
+void
+mt_end(void)
+{
+	mtab.mt_sweep = FALSE;
+	mt_pack();
+}
+
+/*
+ * mt_at:
+ *	Return the monster at a coordinate, newest first like mlist
+ */
+THING *
+mt_at(int y, int x)
+{
+	register int i;
+
+	for (i = mtab.mt_count - 1; i >= 0; i--)
+		if (mtab.mt_x[i] == x && mtab.mt_y[i] == y && mtab.mt_thing[i] != NULL)
+			return mtab.mt_thing[i];
+	return NULL;
+}
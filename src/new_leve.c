@@ -13,12 +13,12 @@
 #define MINTREAS 2	/* minimum number of treasures in a treasure room */
 
 static void	treas_room(void);
+static void	put_horde(void);
 
 void
 new_level(void)
 {
 	register int rm, i;
-	THING *tp;
 	byte *fp;
 	int index;
 	coord stairs;
@@ -36,17 +36,22 @@ new_level(void)
 	if (level > 1 && csum() != cksum)
 		_halt();
 #endif
+	/*
+	 * What the last level's turn drew goes out before it is wiped
+	 */
+	ev_flush();
 	/*
 	 * Clean things off from last level
 	 */
 	setmem(_level, ((MAXLINES-3)*MAXCOLS),' ');
 	setmem(_flags, (MAXLINES-3)*MAXCOLS, F_REAL);
 	/*
-	 * Free up the monsters on the last level
+	 * Forget the monsters on the last level; they, their packs and
+	 * whatever was left lying about all go with the level arena below
 	 */
-	for (tp = mlist; tp != NULL; tp = next(tp))
-		free_list(tp->t_pack);
-	free_list(mlist);
+	mlist = NULL;
+	mt_clear();
+	fov_reset();
 	/*
 	 * just in case we left some flytraps behind
 	 */
@@ -54,7 +59,8 @@ new_level(void)
 	/*
 	 * Throw away stuff left on the previous level (if anything)
 	 */
-	free_list(lvl_obj);
+	lvl_obj = NULL;
+	t_level();
 	do_rooms();				/* Draw rooms */
 #ifdef ROGUE_DOS_CURSES
 	if (max_level == 1) {
@@ -76,6 +82,8 @@ new_level(void)
 	do_passages();			/* Draw passages */
 	no_food++;
 	put_things();			/* Place objects (if any) */
+	if (horde)
+		put_horde();		/* Stress mode: pack the level */
 	/*
 	 * Place the staircase down.
 	 */
@@ -113,6 +121,7 @@ new_level(void)
 	do {
 		rm = rnd_room();
 		rnd_pos(&rooms[rm], &hero);
+		fov_reset();
 		index = INDEX(hero.y, hero.x);
 	} while (!(isfloor(_level[index]) && (_flags[index] & F_REAL)
 				&& moat(hero.y, hero.x) == NULL));
@@ -172,7 +181,7 @@ put_things(void)
 			if ((cur = new_item()) != NULL) {
 				attach(lvl_obj, cur);
 				cur->o_hplus = cur->o_dplus = 0;
-				cur->o_damage = cur->o_hurldmg = "0d0";
+				cur->o_dice = cur->o_hdice = dice_id("0d0");
 				cur->o_ac = 11;
 				cur->o_type = AMULET;
 				/*
@@ -277,9 +286,37 @@ treas_room(void)
 					msg("treasure rm bailout");
 	#endif //TEST
 				tp->t_flags |= ISMEAN;	/* no sloughers in THIS room */
+				mt_sync(tp);
 				give_pack(tp);
 			}
 		}
 	}
 	level--;
 }
+
+/*
+ * put_horde:
+ *	Horde mode: scatter HORDESIZE extra monsters over the level's rooms
+ */
+static
+void
+put_horde(void)
+{
+	register int nm, tries;
+	register THING *tp;
+	coord mp;
+
+	for (nm = 0; nm < HORDESIZE; nm++)
+	{
+		for (tries = 0; tries < MAXTRIES; tries++)
+		{
+			rnd_pos(&rooms[rnd_room()], &mp);
+			if (isfloor(winat(mp.y, mp.x)))
+				break;
+		}
+		if (tries == MAXTRIES)
+			continue;
+		tp = new_item();
+		new_monster(tp, randmonster(FALSE), &mp);
+	}
+}
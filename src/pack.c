@@ -73,7 +73,9 @@ add_pack(THING *obj, bool silent)
 				if (from_floor)
 				{
 					detach(lvl_obj, obj);
-					mvaddch(hero.y, hero.x, floor);
+					obj_unclaim(obj);
+					if (EV_ON(EV_TILE))
+						ev_tile(hero.y, hero.x, floor, NULL, FALSE);
 					chat(hero.y, hero.x) = floor;
 				}
 				discard(obj);
@@ -98,7 +100,9 @@ add_pack(THING *obj, bool silent)
 		if (obj->o_flags & ISFOUND)
 		{
 			detach(lvl_obj, obj);
-			mvaddch(hero.y, hero.x, floor);
+			obj_unclaim(obj);
+			if (EV_ON(EV_TILE))
+				ev_tile(hero.y, hero.x, floor, NULL, FALSE);
 			chat(hero.y, hero.x) = floor;
 			msg("the scroll turns to dust%s.", noterse(" as you pick it up"));
 			return;
@@ -111,8 +115,11 @@ add_pack(THING *obj, bool silent)
 	if (from_floor)
 	{
 		detach(lvl_obj, obj);
-		mvaddch(hero.y, hero.x, floor);
+		obj_unclaim(obj);
+		if (EV_ON(EV_TILE))
+			ev_tile(hero.y, hero.x, floor, NULL, FALSE);
 		chat(hero.y, hero.x) = floor;
+		obj = t_promote(obj);	/* it outlives the level now */
 	}
 	/*
 	 * Search for an object of the same type
@@ -189,32 +196,10 @@ add_pack(THING *obj, bool silent)
 		op->l_prev = obj;
 	}
 picked_up:
-	/*
-	 * If this was the object of something's desire, that monster will
-	 * get mad and run at the hero
-	 */
-	for (op = mlist; op != NULL; op = next(op))
-	{
-		/*
-		 *  compiler bug: jll : 2-7-83
-		 *		It is stupid because it thinks the obj... is not an lvalue
-		 *		this may be true since there is no structure assignments,
-		 *		but still it should let you have the address??!!
-		 *
-		if (&obj->_o._o_pos == op->t_dest)
-		 *
-		 *  the following should do the same
-		 */
-		/*@
-		 * Another bug in Rogue: missed NULL check for t_dest. Monsters could
-		 * be not chasing (sleeping, another room, Ice Monster, etc), so a
-		 * destination could possibly have never been assigned.
-		 */
-		if (op->t_dest != NULL &&
-		   (op->t_dest->x == obj->o_pos.x) && (op->t_dest->y == obj->o_pos.y))
-			op->t_dest = &hero;
-	}
-
+	if (from_floor && EV_ON(EV_PICKED))
+		ev_picked(NULL, obj);
+	//@ A monster that was after the object was sent at the hero by
+	//@ obj_unclaim() when the object left the floor
 	if (obj->o_type == AMULET)
 	{
 		amulet = TRUE;
@@ -233,6 +218,7 @@ picked_up:
 		int cur_power = cur_weapon->o_hplus + cur_weapon->o_dplus;
 		if (new_power > cur_power) {
 			cur_weapon = obj;
+			power_reset();
 			msg("Auto-equipped %s!", inv_name(obj, TRUE));
 		}
 	} else if (obj->o_type == ARMOR && cur_armor) {
@@ -312,6 +298,7 @@ pick_up(byte ch)
 		return;
 		money(obj->o_goldval);
 		detach(lvl_obj, obj);
+		obj_unclaim(obj);
 		discard(obj);
 		proom->r_goldval = 0;
 		break;
@@ -444,7 +431,8 @@ money(int value)
 
 	floor = (proom->r_flags & ISGONE) ? PASSAGE : FLOOR;
 	purse += value;
-	mvaddch(hero.y, hero.x, floor);
+	if (EV_ON(EV_TILE))
+		ev_tile(hero.y, hero.x, floor, NULL, FALSE);
 	chat(hero.y, hero.x) = floor;
 	if (value > 0)
 	{
@@ -36,8 +36,10 @@ quaff(void)
 		msg("yuk! Why would you want to drink that?");
 		return;
 	}
-	if (obj == cur_weapon)
+	if (obj == cur_weapon) {
 		cur_weapon = NULL;
+		power_reset();
+	}
 
 	/*
 	 * Calculate the effect it has on the poor guy.
@@ -71,7 +73,10 @@ quaff(void)
 	when P_HEALING:
 		p_know[P_HEALING] = TRUE;
 		if ((pstats.s_hpt += roll(pstats.s_lvl, 4)) > max_hp)
+		{
 			pstats.s_hpt = ++max_hp;
+			power_reset();
+		}
 		sight();
 		msg("you begin to feel better");
 	when P_STRENGTH:
@@ -166,6 +171,7 @@ quaff(void)
 			if (pstats.s_hpt > max_hp + pstats.s_lvl + 1)
 				++max_hp;
 			pstats.s_hpt = ++max_hp;
+			power_reset();
 		}
 		sight();
 		msg("you begin to feel much better");
@@ -184,6 +190,7 @@ quaff(void)
 			add_str(&pstats.s_str, cur_ring[LEFT]->o_ac);
 		if (ISRING(RIGHT, R_ADDSTR))
 			add_str(&pstats.s_str, cur_ring[RIGHT]->o_ac);
+		power_reset();
 		msg("%syou feel warm all over",
 			noterse("hey, this tastes great.  It makes "));
 	when P_BLIND:
@@ -191,6 +198,7 @@ quaff(void)
 		if (!on(player, ISBLIND))
 		{
 			player.t_flags |= ISBLIND;
+			fov_reset();
 			fuse(sight, SEEDURATION);
 			look(FALSE);
 		}
@@ -285,20 +293,25 @@ th_effect(THING *obj, THING *tp)
 	when P_CONFUSE:
 	case P_BLIND:
 		tp->t_flags |= ISHUH;
+		mt_sync(tp);
 		msg("the %s appears confused", monsters[tp->t_type-'A'].m_name);
 	when P_PARALYZE:
 		tp->t_flags &= ~ISRUN;
 		tp->t_flags |= ISHELD;
+		mt_sync(tp);
 	when P_HEALING:
 	case P_XHEAL:
 		if ((tp->t_stats.s_hpt += rnd(8)) > tp->t_stats.s_maxhp)
 		tp->t_stats.s_hpt = ++tp->t_stats.s_maxhp;
+		power_monster(tp);
 	when P_RAISE:
 		tp->t_stats.s_hpt += 8;
 		tp->t_stats.s_maxhp += 8;
 		tp->t_stats.s_lvl++;
+		power_monster(tp);
 	when P_HASTE:
 		tp->t_flags |= ISHASTE;
+		mt_sync(tp);
 		break;
 	}
 	msg("the flask shatters.");
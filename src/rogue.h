@@ -77,6 +77,8 @@
 #define MAXNAME		20  /* Maximum Length of a scroll */
 #define MAXSTR		128 /* Standard buffer size for string operations */
 #define MAXITEMS	83  /* Maximum number of randomly generated things */
+#define THINGBLK	MAXITEMS  /* THINGs added to the pool at a time */
+#define HORDESIZE	250 /* Extra monsters per level in horde mode */
 #define BUFSIZE		128 /*@ moved from curses.h */
 
 /*
@@ -100,7 +102,6 @@
 #define hero		player.t_pos
 #define pstats		player.t_stats
 #define pack		player.t_pack
-#define proom		player.t_room
 #define max_hp		player.t_stats.s_maxhp
 #define attach(a,b)	list_attach(&a,b)
 #define detach(a,b)	list_detach(&a,b)
@@ -143,6 +144,14 @@
 #define RIGHT		1
 #define BOLT_LENGTH	6
 #define LAMPDIST	3
+#define SCHED_TURN	60	/* scheduler ticks in a turn at normal speed */
+
+/*
+ * Daemon priorities, the lowest runs first each turn
+ */
+#define DP_HERO		10	/* doctor, stomach */
+#define DP_MONST	20	/* runners */
+#define DP_WANDER	30	/* rollwand */
 
 /*
  * Save against things
@@ -331,6 +340,9 @@ enum AffixType {
     MOD_HP      // Max HP
 };
 
+#define NUM_PREFIXES 6  // Must match array size in init.c
+#define NUM_SUFFIXES 6  // Must match array size in init.c
+
 struct Affix {
     char *name;
     enum AffixType type;
@@ -423,6 +435,28 @@ struct room {
 	coord r_exit[12];			/* Where the exits are */
 };
 
+/*
+ * Damage dice compiled from a string like "1d8/1d8/3d6": one attack
+ * per '/', each a roll of a_count dice with a_sides sides plus a_plus.
+ * They live in a table (see dice.c) and THINGs hold the index.
+ */
+#define MAXATTACK	4
+#define DICE(id)	(&dice_tab[id])
+
+struct attack {
+	shint a_count;			/* Dice rolled */
+	shint a_sides;			/* Sides on each die */
+	shint a_plus;			/* Added to the roll */
+};
+
+struct dice {
+	shint d_natt;			/* Number of attacks, 0 if none */
+	struct attack d_att[MAXATTACK];
+	shint d_avg;			/* Average damage, rounded per attack */
+	float d_mean;			/* Mean damage of all the attacks */
+	float d_var;			/* And its variance */
+};
+
 /*
  * Structure describing a fighting being
  */
@@ -437,68 +471,157 @@ struct stats {
 };
 
 /*
- * Structure for monsters and player
+ * Where a monster is running to.  Nothing in it points anywhere: an
+ * object is its pool id and generation, gold is the room it's in.
+ */
+#define TG_HERO		0	/* The hero */
+#define TG_OBJECT	1	/* An object it has claimed */
+#define TG_GOLD		2	/* The gold of a room */
+#define TG_COORD	3	/* A square */
+
+/*
+ * Game events, see event.c.  EV_ON() is the test every post is
+ * guarded with, so nobody pays for events no sink wants.
+ */
+#define EV_MOVED	0	/* A monster moved from ev_from to ev_pos */
+#define EV_PICKED	1	/* Something picked up the object ev_other */
+#define EV_DAMAGE	2	/* ev_other hit ev_who for ev_amount */
+#define EV_MESSAGE	3	/* A message, ev_text() has it */
+#define EV_TILE		4	/* The square ev_pos now shows ev_ch, the
+				 * monster ev_who if not -1, in standout
+				 * if ev_amount */
+#define NEVENT		5
+
+#define EV_BIT(t)	(1 << (t))
+#define EV_ALL		(EV_BIT(NEVENT) - 1)
+#define EV_ON(t)	(ev_want & EV_BIT(t))
+
+struct event {
+	coord ev_pos;			/* Where it happened */
+	coord ev_from;			/* Where it came from */
+	int ev_who;			/* l_id of the monster, -1 the hero */
+	int ev_other;			/* l_id of the object or attacker */
+	int ev_amount;			/* Damage, count, or the text */
+	byte ev_type;			/* What happened, EV_... */
+	byte ev_ch;			/* What it looks like */
+};
+
+struct target {
+	coord tg_pos;			/* TG_COORD: the square */
+	int tg_id;			/* TG_OBJECT: l_id of the object */
+	int tg_gen;			/* and its generation */
+	signed char tg_room;		/* TG_GOLD: room_id() of the room */
+	byte tg_kind;			/* What it is, TG_... */
+};
+
+/*
+ * Structure for monsters and player.  Both halves are packed widest
+ * field first; what isn't a list link or a pack is an index or an id
+ * (target, dice, room, rarity, affixes) rather than a pointer.
  */
 union thing {
 	struct {
 	union thing *_l_next, *_l_prev;	/* Next pointer in link */
+	int _l_id;			/* Its index in the THING pool */
 	coord _t_pos;			/* Position */
-	char _t_turn;			/* If slowed, is it a turn to move */
+	union thing *_t_pack;		/* What the thing is carrying */
+	struct stats _t_stats;		/* Physical description */
+	struct target _t_dest;		/* Where it is running to */
+	short _t_slot;			/* Row in the monster table */
+	short _t_flags;			/* State word */
+	short _t_power;			/* Power score for the threat HUD */
+	short _t_dice;			/* s_dmg compiled, see DICE() */
 	char _t_type;			/* What it is */
 	byte _t_disguise;		/* What mimic looks like */
 	byte _t_oldch;			/* Character that was where it was */
-	coord *_t_dest;			/* Where it is running to */
-	short _t_flags;			/* State word */
-	struct stats _t_stats;		/* Physical description */
-	struct room *_t_room;		/* Current room for thing */
-	union thing *_t_pack;		/* What the thing is carrying */
-	ItemRarity _t_rarity;		/* Rarity level for bosses */
-	MonsterAffix _t_affix;		/* Special ability for bosses */
+	signed char _t_room;		/* Current room for thing, see room_id() */
+	byte _t_rarity;			/* Rarity level for bosses, an ItemRarity */
+	byte _t_affix;			/* Special ability for bosses, a MonsterAffix */
 	} _t;
 	struct {
 	union thing *_l_next, *_l_prev;	/* Next pointer in link */
+	int _l_id;			/* Its index in the THING pool */
+	union thing *_o_claim;		/* Monster running to it, if any */
 	shint _o_type;			/* What kind of object it is */
 	coord _o_pos;			/* Where it lives on the screen */
-	char *_o_text;			/* What it says if you read it */
-	char _o_launch;			/* What you need to launch it */
-	char *_o_damage;		/* Damage if used like sword */
-	char *_o_hurldmg;		/* Damage if thrown */
 	shint _o_count;			/* Count for plural objects */
 	shint _o_which;			/* Which object of a type it is */
 	shint _o_hplus;			/* Plusses to hit */
 	shint _o_dplus;			/* Plusses to damage */
+	shint _o_group;			/* Group number for this object */
 	short _o_ac;			/* Armor class */
 	short _o_flags;			/* Information about objects */
+	short _o_dice;			/* Damage if used like sword, see DICE() */
+	short _o_hdice;			/* Damage if thrown */
+	char _o_launch;			/* What you need to launch it */
 	char _o_enemy;			/* If it is enchanted, who it hates */
-	shint _o_group;			/* Group number for this object */
-	ItemRarity _o_rarity;		/* Rarity level (COMMON, MAGIC, etc.) */
-	int _o_prefix_id;		/* ID for prefix affix (0 = none) */
-	int _o_suffix_id;		/* ID for suffix affix (0 = none) */
+	byte _o_rarity;			/* Rarity level, an ItemRarity */
+	byte _o_prefix_id;		/* ID for prefix affix (0 = none) */
+	byte _o_suffix_id;		/* ID for suffix affix (0 = none) */
 	} _o;
 };
 
 typedef union thing THING;
 
+/*
+ * THING arenas: what the hero carries lasts the whole game, everything
+ * else is thrown away with the level in one go
+ */
+#define A_GAME		0
+#define A_LEVEL		1
+#define NARENA		2
+
+struct arena {
+	THING **a_blk;			/* Blocks of THINGBLK things */
+	int **a_gen;			/* Generations, odd in use, per block */
+	int a_nblk;			/* Number of blocks */
+	int a_next;			/* Never handed out since the reset */
+	int *a_free;			/* Indexes given back, a stack */
+	int a_nfree;
+	int a_inuse;			/* Things in use */
+};
+
+/*
+ * Monster table: the state runners() reads every turn, one array per
+ * field.  THINGs stay the accessor layer; whoever changes a monster's
+ * position or flags calls mt_sync() so its row follows.  Turn state
+ * lives only here and in the scheduler's queue.
+ */
+struct mtable {
+	THING **mt_thing;		/* The monster, NULL if it died */
+	shint *mt_y;			/* Position */
+	shint *mt_x;
+	short *mt_flags;		/* State word */
+	char *mt_type;			/* What it is */
+	int *mt_qpos;			/* Where it is in the schedule, -1 if not */
+	int mt_count;			/* Rows in use */
+	int mt_size;			/* Rows allocated */
+	bool mt_sweep;			/* runners() is walking the table */
+};
+
 #define l_next		_t._l_next
 #define l_prev		_t._l_prev
+#define l_id		_t._l_id
 #define t_pos		_t._t_pos
-#define t_turn		_t._t_turn
+#define t_slot		_t._t_slot
 #define t_type		_t._t_type
 #define t_disguise	_t._t_disguise
 #define t_oldch		_t._t_oldch
 #define t_dest		_t._t_dest
 #define t_flags		_t._t_flags
 #define t_stats		_t._t_stats
+#define t_dice		_t._t_dice
+#define t_power		_t._t_power
 #define t_pack		_t._t_pack
 #define t_room		_t._t_room
 #define t_rarity	_t._t_rarity
 #define t_affix		_t._t_affix
 #define o_type		_o._o_type
 #define o_pos		_o._o_pos
-#define o_text		_o._o_text
+#define o_claim		_o._o_claim
 #define o_launch	_o._o_launch
-#define o_damage	_o._o_damage
-#define o_hurldmg	_o._o_hurldmg
+#define o_dice		_o._o_dice
+#define o_hdice		_o._o_hdice
 #define o_count		_o._o_count
 #define o_which		_o._o_which
 #define o_hplus		_o._o_hplus
@@ -542,7 +665,8 @@ extern char *s_guess[], *p_guess[], *r_guess[], *ws_guess[];
 extern char f_damage[];
 
 extern bool amulet, after, again, door_stop, expert, fastmode, faststate,
-			firstmove, noscore, playing, running, save_msg, saw_amulet, terse;
+			firstmove, horde, noscore, playing, running, save_msg, saw_amulet,
+			terse;
 
 //@ originally a bool. See extern.c, move.c, misc.c
 extern unsigned char was_trapped;
@@ -579,9 +703,18 @@ extern THING *cur_armor, *cur_ring[], *cur_weapon,
 		*cur_helmet, *cur_gloves, *cur_boots, *cur_shield,
 		*lvl_obj, *mlist, player;
 
+extern struct mtable	mtab;
+
 extern coord	delta, oldpos;
 
-extern struct room	*oldrp, passages[], rooms[];
+extern struct room	*oldrp, *proom, passages[], rooms[];
+extern struct dice	*dice_tab;
+
+/*
+ * The room of a room_id()
+ */
+#define ROOM_AT(id)	((id) < 0 ? NULL : (id) < MAXROOMS ? &rooms[id] \
+			  : &passages[(id) - MAXROOMS])
 
 extern struct stats	max_stats;
 
@@ -610,7 +743,7 @@ extern int captains_log;
 
 //@ env.c
 extern char s_menu[], s_fruit[], s_score[], s_save[], s_macro[];
-extern char s_drive[], s_screen[];
+extern char s_drive[], s_screen[], s_frame[], s_link[];
 extern char fruit[], macro[], whoami[];
 //@ extern char s_name[];  //@ not found. Perhaps old name for whoami[]?
 
@@ -620,8 +753,7 @@ extern char *tbuf, *prbuf;
 extern byte *_level, *_flags;
 extern long *e_levels;
 extern char *msgbuf;
-extern THING *_things;
-extern int   *_t_alloc;
+extern struct arena _arena[NARENA];
 extern char *ring_buf;
 //@ extern char *_top, *_base;  //@ not found
 /*@
@@ -629,6 +761,8 @@ extern char *ring_buf;
  * extern char *end_mem;
  */
 
+//@ event.c
+extern int ev_want;
 
 //@ protect.c
 extern int no_step;  //@ used in clock(), originally set by dos.asm
@@ -649,7 +783,7 @@ void	update_armor_class(void);
 void	waste_time(void);
 
 //@ chase.c
-void	runners(void);
+void	runners(void *arg);
 void	do_chase(THING *th);
 void	chase(THING *tp, coord *ee);
 void	start_run(coord *runner);
@@ -657,7 +791,11 @@ bool	see_monst(THING *mp);
 bool	diag_ok(coord *sp, coord *ep);
 bool	cansee(int y, int x);
 struct room	*roomin(coord *cp);
-coord	*find_dest(THING *tp);
+void	find_dest(THING *tp);
+void	dest_hero(THING *tp);
+void	dest_gold(THING *tp, struct room *rp);
+coord	*dest_pos(THING *tp);
+void	obj_unclaim(THING *obj);
 
 //@ command.c
 void	command(void);
@@ -665,26 +803,52 @@ void	show_count(void);
 void	execcom(void);
 
 //@ daemon.c
-void	start_daemon(void (*func)());
+int	start_daemon(char *name, int prio, int every, void (*func)(void *),
+	    void *arg);
 void	do_daemons(void);
-void	fuse(void (*func)(), int time);
+int	fuse(void (*func)(), int time);
+void	fuse_lengthen(int h, int xtime);
+void	fuse_cancel(int h);
 void	lengthen(void (*func)(), int xtime);
 void	extinguish(void (*func)());
 void	do_fuses(void);
+void	d_free(void);
+#ifdef WIZARD
+void	d_report(void);
+#endif
+void	d_print(void);
 
 //@ daemons.c
-void	doctor(void);
+void	doctor(void *arg);
 void	swander(void);
-void	rollwand(void);
+void	rollwand(void *arg);
 void	unconfuse(void);
 void	unsee(void);
 void	sight(void);
 void	nohaste(void);
-void	stomach(void);
+void	stomach(void *arg);
+
+//@ dice.c
+int	dice_id(const char *str);
+int	dice_roll(const struct attack *ap);
+void	dice_free(void);
 
 //@ env.h
 bool	setenv_from_file(char *envfile);
 
+//@ event.c
+int	ev_sink(int mask, bool now, void (*func)(struct event *ep, int n,
+	    void *arg), void *arg);
+void	ev_unsink(int id);
+void	ev_flush(void);
+char	*ev_text(struct event *ep);
+void	ev_moved(THING *tp, coord *from);
+void	ev_picked(THING *tp, THING *obj);
+void	ev_damage(THING *att, THING *def, int amount);
+void	ev_message(char *text);
+void	ev_tile(int y, int x, byte ch, THING *tp, bool so);
+void	ev_free(void);
+
 //@ fakedos.c
 void	fakedos(void);
 
@@ -705,9 +869,15 @@ void	remove_monster(coord *mp, THING *tp, bool waskill);
 void	killed(THING *tp, bool pr);
 int	str_plus(str_t str);
 int	add_dam(str_t str);
+void	power_reset(void);
+void	power_monster(THING *tp);
 threat_level_t	monster_threat_level(const THING *monster);
 void	threat_apply_color(threat_level_t level);
 
+//@ fov.c
+void	fov_reset(void);
+bool	fov_see(int y, int x);
+
 //@ init.c
 void	init_player(void);
 void	init_things(void);
@@ -721,6 +891,7 @@ char	*getsyl(void);
 char	rchr(char *string);
 
 //@ io.c
+void	io_sinks(void);
 void	ifterse(const char *tfmt, const char *fmt, ...);
 void	msg(const char *fmt, ...);
 void	vmsg(const char *fmt, va_list argp);
@@ -742,10 +913,21 @@ char	*noterse(char *str);
 
 //@ list.c
 THING	*new_item(void);
+THING	*game_item(void);
 void	list_detach(THING **list, THING *item);
 void	list_attach(THING **list, THING *item);
 void	list_free(THING **ptr);
 int	discard(THING *item);
+void	t_copy(THING *dest, THING *source);
+THING	*t_promote(THING *item);
+THING	*t_demote(THING *item);
+int	t_gen(THING *item);
+THING	*t_handle(int id, int gen);
+bool	t_live(THING *item, int gen);
+bool	t_inuse(THING *item);
+void	t_level(void);
+void	t_reset(void);
+void	t_free(void);
 
 //@ load.c
 void	epyx_yuck(void);
@@ -813,12 +995,24 @@ bool	istest(void);
 char	randmonster(bool wander);
 char	pick_mons(void);
 void	new_monster(THING *tp, byte type, coord *cp);
+void	legendary(THING *tp);
 void	f_restor(void);
+void	f_grow(void);
 void	wanderer(void);
 void	give_pack(THING *tp);
 THING	*wake_monster(int y, int x);
 THING	*moat(int my, int mx);
 
+//@ mtable.c
+void	mt_add(THING *tp);
+void	mt_del(THING *tp);
+void	mt_sync(THING *tp);
+void	mt_clear(void);
+void	mt_free(void);
+void	mt_begin(void);
+void	mt_end(void);
+THING	*mt_at(int y, int x);
+
 //@ move.c
 void	do_run(byte ch);
 void	do_move(int dy, int dx);
@@ -882,11 +1076,21 @@ void	draw_room(struct room *rp);
 void	rnd_pos(struct room *rp, coord *cp);
 void	enter_room(coord *cp);
 void	leave_room(coord *cp);
+int	room_id(struct room *rp);
 
 //@ save.c
 void	save_game(void);
 void	restore(char *savefile);
 
+//@ sched.c
+int	sched_delay(THING *tp);
+void	sched_add(THING *tp);
+void	sched_del(THING *tp);
+long	sched_hero(void);
+THING	*sched_next(long until);
+void	sched_clear(void);
+void	sched_free(void);
+
 //@ scrolls.c
 void read_scroll(void);
 
@@ -915,6 +1119,7 @@ void	lcase(char *str);
 
 //@ things.c
 char	*inv_name(THING *obj, bool drop);
+void	name_dirty(void);
 void	drop(void);
 void	discovered(void);
 bool	can_drop(THING *op);
@@ -922,6 +1127,7 @@ THING	*new_thing(void);
 byte	add_line(char *use, char *fmt, char *arg);
 byte	end_line(char *use);
 void apply_diablo_stats(THING *obj, int d_level);
+int get_affix_value(struct Affix *table, int index);
 
 //@ weapons.c
 void	missile(int ydelta, int xdelta);
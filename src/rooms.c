@@ -221,6 +221,7 @@ enter_room(coord *cp)
 	register THING *tp;
 
 	rp = proom = roomin(cp);
+	fov_reset();
 	if (bailout || ((rp->r_flags & ISGONE) && (rp->r_flags & ISMAZE) == 0)) {
 #ifdef DEBUG
 		msg("in a gone room");
@@ -231,6 +232,7 @@ enter_room(coord *cp)
 	if (!(rp->r_flags&ISDARK) && !on(player,ISBLIND) && !(rp->r_flags&ISMAZE))
 		for (y = rp->r_pos.y; y < rp->r_max.y + rp->r_pos.y; y++) {
 			move(y, rp->r_pos.x);
+			cur_span();
 			for (x = rp->r_pos.x; x < rp->r_max.x + rp->r_pos.x; x++) {
 				/*
 				 * Displaying monsters is all handled in the
@@ -238,12 +240,13 @@ enter_room(coord *cp)
 				 */
 				tp = moat(y, x);
 				if (tp == NULL || !see_monst(tp))
-					addch(chat(y, x));
+					cur_spanch(chat(y, x));
 				else {
 					tp->t_oldch = chat(y,x);
-					addch(tp->t_disguise);
+					cur_spanch(tp->t_disguise);
 				}
 			}
+			cur_spanend();
 		}
 }
 
@@ -261,6 +264,7 @@ leave_room(coord *cp)
 
 	rp = proom;
 	proom = &passages[flat(cp->y, cp->x) & F_PNUM];
+	fov_reset();
 	floor = ((rp->r_flags & ISDARK) && !on(player, ISBLIND)) ? ' ' : FLOOR;
 	if (rp->r_flags & ISMAZE)
 		floor = PASSAGE;
@@ -298,3 +302,18 @@ leave_room(coord *cp)
 			}
 	door_open(rp);
 }
+
+/*
+ * room_id:
+ *	A small number for a room or a passage, to keep in a THING:
+ *	rooms first, then passages, -1 for none.  ROOM_AT() turns it back.
+ */
+int
+room_id(struct room *rp)
+{
+	if (rp == NULL)
+		return -1;
+	if (rp >= rooms && rp < &rooms[MAXROOMS])
+		return rp - rooms;
+	return MAXROOMS + (rp - passages);
+}
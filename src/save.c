@@ -254,6 +254,7 @@ rok:
 	//@ no longer needed, memory is now managed via malloc()
 	//@ brk(end_sb);					/* Restore heap to empty state */
 	init_ds();
+	name_dirty();		/* the guesses came back with the rest */
 	/*@
 	 * There is a very clever trick going on here: by resetting the heap with
 	 * brk(end_sb) and immediately calling init_ds() it guarantees that
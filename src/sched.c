@@ -0,0 +1,247 @@
+/*
+ * Energy scheduler: every creature acts at its own pace, and the
+ * running monsters wait in a heap ordered by the time of their next
+ * action
+ *
+ * sched.c
+ */
+
+#include "rogue.h"
+#include "curses.h"
+
+struct sched {
+	long s_time;			/* When it acts next */
+	long s_ticket;			/* Equal times go in queueing order */
+	THING *s_thing;
+};
+
+static struct sched *sq;
+static int sq_count, sq_size;
+static long sq_ticket;
+
+/*
+ * The clock: the time of the action being taken, and of the hero's
+ * next one.  Monsters woken up in between are queued from now.
+ */
+static long sched_now, sched_hero_t;
+
+static bool	sq_before(struct sched *a, struct sched *b);
+static void	sq_put(int i, struct sched *sp);
+static void	sq_up(int i);
+static void	sq_down(int i);
+static void	sq_take(int i);
+static void	sq_grow(void);
+
+/*
+ * sched_delay:
+ *	Ticks between two actions of a creature.  A monster's pace is
+ *	counted in half actions a turn: slow ones and slimes far from the
+ *	hero get one, hasted ones two more and flyers far from the hero
+ *	two more again.  A hasted hero moves two and a half times a turn.
+ */
+int
+sched_delay(THING *tp)
+{
+	register int rate, dist;
+
+	if (tp == &player)
+		return on(player, ISHASTE) ? SCHED_TURN * 2 / 5 : SCHED_TURN;
+	dist = DISTANCE(hero.y, hero.x, tp->t_pos.y, tp->t_pos.x);
+	if (on(*tp, ISSLOW) || (tp->t_type == 'S' && dist > 3))
+		rate = 1;
+	else
+		rate = 2;
+	if (on(*tp, ISHASTE))
+		rate += 2;
+	if (on(*tp, ISFLY) && dist > 3)
+		rate += 2;
+	return SCHED_TURN * 2 / rate;
+}
+
+/*
+ * sched_add:
+ *	Queue a running monster for its next action, unless it already
+ *	is.  It must be in the monster table.
+ */
+void
+sched_add(THING *tp)
+{
+	struct sched s;
+
+	if (mtab.mt_qpos[tp->t_slot] >= 0)
+		return;
+	if (sq_count >= sq_size)
+		sq_grow();
+	s.s_time = sched_now + sched_delay(tp);
+	s.s_ticket = ++sq_ticket;
+	s.s_thing = tp;
+	sq_put(sq_count++, &s);
+	sq_up(sq_count - 1);
+}
+
+/*
+ * sched_del:
+ *	Take a monster in the table out of the queue
+ */
+void
+sched_del(THING *tp)
+{
+	register int i;
+
+	if ((i = mtab.mt_qpos[tp->t_slot]) >= 0)
+		sq_take(i);
+}
+
+/*
+ * sched_hero:
+ *	The hero has taken an action; start the clock on his next one
+ *	and return its time
+ */
+long
+sched_hero(void)
+{
+	sched_now = sched_hero_t;
+	sched_hero_t += sched_delay(&player);
+	return sched_hero_t;
+}
+
+/*
+ * sched_next:
+ *	Take the monster whose action comes next, if it comes no later
+ *	than until.  When none is left the clock moves on to until.
+ */
+THING *
+sched_next(long until)
+{
+	register THING *tp;
+
+	if (sq_count == 0 || sq[0].s_time > until) {
+		sched_now = until;
+		return NULL;
+	}
+	tp = sq[0].s_thing;
+	sched_now = sq[0].s_time;
+	sq_take(0);
+	return tp;
+}
+
+/*
+ * sched_clear:
+ *	Empty the queue, the level is going away.  The clock runs on.
+ */
+void
+sched_clear(void)
+{
+	sq_count = 0;
+}
+
+/*
+ * sched_free:
+ *	Give back the memory of the queue
+ */
+void
+sched_free(void)
+{
+	free(sq);
+	sq = NULL;
+	sq_count = sq_size = 0;
+}
+
+/*
+ * sq_before:
+ *	Does a come out of the heap before b?
+ */
+static
+bool
+sq_before(struct sched *a, struct sched *b)
+{
+	if (a->s_time != b->s_time)
+		return a->s_time < b->s_time;
+	return a->s_ticket < b->s_ticket;
+}
+
+/*
+ * sq_put:
+ *	Store an entry in the heap and tell its monster where it is
+ */
+static
+void
+sq_put(int i, struct sched *sp)
+{
+	sq[i] = *sp;
+	mtab.mt_qpos[sp->s_thing->t_slot] = i;
+}
+
+/*
+ * sq_up, sq_down:
+ *	Move an entry towards the top or the bottom of the heap until
+ *	it is in order again
+ */
+static
+void
+sq_up(int i)
+{
+	register int p;
+	struct sched s;
+
+	s = sq[i];
+	for (; i > 0 && sq_before(&s, &sq[p = (i - 1) / 2]); i = p)
+		sq_put(i, &sq[p]);
+	sq_put(i, &s);
+}
+
+static
+void
+sq_down(int i)
+{
+	register int c;
+	struct sched s;
+
+	s = sq[i];
+	while ((c = 2 * i + 1) < sq_count) {
+		if (c + 1 < sq_count && sq_before(&sq[c + 1], &sq[c]))
+			c++;
+		if (!sq_before(&sq[c], &s))
+			break;
+		sq_put(i, &sq[c]);
+		i = c;
+	}
+	sq_put(i, &s);
+}
+
+/*
+ * sq_take:
+ *	Remove the entry at i from the heap
+ */
+static
+void
+sq_take(int i)
+{
+	register THING *tp;
+
+	mtab.mt_qpos[sq[i].s_thing->t_slot] = -1;
+	if (i != --sq_count) {
+		tp = sq[sq_count].s_thing;
+		sq_put(i, &sq[sq_count]);
+		sq_up(i);
+		sq_down(mtab.mt_qpos[tp->t_slot]);
+	}
+}
+
+/*
+ * sq_grow:
+ *	Double the room in the heap
+ */
+static
+void
+sq_grow(void)
+{
+	struct sched *new;
+
+	sq_size = sq_size ? sq_size * 2 : MAXITEMS;
+	new = (struct sched *) newmem(sq_size * sizeof(struct sched));
+	if (sq_count > 0)
+		memcpy(new, sq, sq_count * sizeof(struct sched));
+	free(sq);
+	sq = new;
+}
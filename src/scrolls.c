@@ -34,8 +34,10 @@ read_scroll()
 	/*
 	 * Calculate the effect it has on the poor guy.
 	 */
-	if (obj == cur_weapon)
+	if (obj == cur_weapon) {
 		cur_weapon = NULL;
+		power_reset();
+	}
 	switch (obj->o_which){
 	when S_CONFUSE:
 		/*
@@ -62,6 +64,7 @@ read_scroll()
 					if ((y > 0 && y < maxrow) && ((op=moat(y, x)) != NULL)) {
 						op->t_flags &= ~ISRUN;
 						op->t_flags |= ISHELD;
+						mt_sync(op);
 					}
 	when S_SLEEP:
 		/*
@@ -181,6 +184,7 @@ read_scroll()
 			cur_weapon->o_hplus++;
 		else
 			cur_weapon->o_dplus++;
+		power_reset();
 		ifterse1("your %s glows blue","your %s glows blue for a moment", w_names[cur_weapon->o_which]);
 		}
 	when S_SCARE:
@@ -257,6 +261,7 @@ read_scroll()
 					}
 				 */
 			}
+			power_reset();
 		}
 	otherwise:
 		msg("what a puzzling scroll!");
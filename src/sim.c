@@ -0,0 +1,526 @@
+/*
+ * Combat simulator: fight a class loadout against one kind of monster
+ * over and over with the game's own rules, and report how it went
+ *
+ * sim.c
+ *
+ * Build with "make sim".  The loadout is the one init_player() gives,
+ * optionally with another weapon rolled through apply_diablo_stats().
+ * The monster comes from new_monster(), so depth scaling and bosses are
+ * the real ones.  Each exchange is the player's swing as in fight() and
+ * the monster's as in attack(), both through roll_em(), with the boss
+ * affixes applied as fight() and attack() do.  The monsters' other
+ * special attacks (rust, drain, steal...) are not simulated.
+ *
+ * The fights are split over one process per core, each with its own
+ * seed, and the results are summed when they are all done.
+ */
+
+#include "rogue.h"
+#include "curses.h"
+#include <sys/wait.h>
+
+extern struct Affix prefixes[];
+extern struct Affix suffixes[];
+
+#define SIMTURNS	200		/* Turns before a fight is a stalemate */
+#define SIMDMG		64		/* Damage histogram buckets */
+
+/*
+ * What a batch of fights came to.  The last bucket of each histogram
+ * holds everything past it.
+ */
+struct simres {
+	long r_fights;			/* Fights fought */
+	long r_won, r_lost, r_fled;	/* How they ended */
+	long r_pswing, r_phit;		/* Player's swings and hits */
+	long r_mswing, r_mhit;		/* Monster's swings and hits */
+	long r_hpleft;			/* Player's hit points left, summed over wins */
+	long r_kill[SIMTURNS + 1];	/* Turns to kill the monster */
+	long r_die[SIMTURNS + 1];	/* Turns to die */
+	long r_pdmg[SIMDMG + 1];	/* Damage per player hit */
+	long r_mdmg[SIMDMG + 1];	/* Damage per monster hit */
+};
+
+static THING sim_player;		/* The player as the loadout left him */
+static THING sim_mon;			/* The monster being fought */
+static coord sim_pos = { 10, 10 };	/* Where the fights happen */
+static char sim_type = 'K';		/* -m: monster letter */
+static int sim_boss = -1;		/* -b: boss affix, -1 if not a boss */
+static bool sim_legend = FALSE;		/* -L: legendary boss */
+
+static void	usage(void);
+static int	lookup(char *name, char **names, int n);
+static int	affix(char *name, struct Affix *table, int n);
+static void	loadout(char *wname, int plus, int rarity, int pre, int suf,
+			bool apply, int xlvl);
+static void	bonus(THING *weap, struct Affix *table, int index);
+static void	spawn(void);
+static void	batch(struct simres *rp, long n);
+static void	sum(struct simres *to, struct simres *from);
+static void	die(char *fmt, char *arg);
+static void	bucket(long *hist, int n, int val);
+static void	report(struct simres *rp);
+static void	histogram(char *title, long *hist, int n, long total);
+static int	pctile(long *hist, int n, long total, int pct);
+
+static char *cl_names[] = { "warrior", "rogue", "sorcerer" };
+static char *ra_names[] = { "common", "magic", "rare", "legendary" };
+static char *ma_names[] = { "none", "vampiric", "thorns", "teleporter" };
+
+/*
+ * main:
+ *	Set up the loadout and the monster, farm the fights out to the
+ *	workers and print what they found
+ */
+int
+main(int argc, char **argv)
+{
+	struct simres res, part;
+	char *wname = NULL;
+	int c, i, jobs, plus = 0, rarity = -1, pre = -1, suf = -1, xlvl = 1;
+	int depth = 1, (*fds)[2];
+	long fights = 1000000L, n;
+	bool apply = FALSE;
+	pid_t pid;
+
+	player_class = C_WARRIOR;
+	seed = md_time();
+	jobs = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	while ((c = getopt(argc, argv, "c:w:e:r:p:s:am:b:Ld:x:n:j:S:")) != -1)
+		switch (c) {
+		when 'c': player_class = lookup(optarg, cl_names, 3);
+		when 'w': wname = optarg;
+		when 'e': plus = atoi(optarg);
+		when 'r': rarity = lookup(optarg, ra_names, 4);
+		when 'p': pre = affix(optarg, prefixes, NUM_PREFIXES);
+		when 's': suf = affix(optarg, suffixes, NUM_SUFFIXES);
+		when 'a': apply = TRUE;
+		when 'm':
+			sim_type = optarg[0];
+			if (sim_type < 'A' || sim_type > 'Z')
+				usage();
+		when 'b': sim_boss = lookup(optarg, ma_names, 4);
+		when 'L': sim_legend = TRUE;
+		when 'd': depth = atoi(optarg);
+		when 'x': xlvl = atoi(optarg);
+		when 'n': fights = atol(optarg);
+		when 'j': jobs = atoi(optarg);
+		when 'S': seed = atol(optarg);
+		otherwise: usage();
+		}
+	if (optind != argc || depth < 1 || xlvl < 1 || xlvl > 20
+	  || fights < 1 || (sim_boss >= 0 && depth < 2))
+		usage();
+	if (jobs < 1)
+		jobs = 1;
+	if (jobs > fights)
+		jobs = (int) fights;
+
+	init_ds();
+	level = max_level = depth;
+	hit_mul = 1;
+	rooms[0].r_max.x = MAXCOLS;
+	rooms[0].r_max.y = MAXLINES - 3;
+	init_materials();
+	loadout(wname, plus, rarity, pre, suf, apply, xlvl);
+
+	printf("%s, level %d, %d hp, str %u, ", cl_names[player_class],
+		pstats.s_lvl, max_hp, pstats.s_str);
+	printf("%s\n", cur_weapon != NULL ? inv_name(cur_weapon, FALSE) : "bare handed");
+	printf("vs %s at depth %d%s%s%s, %ld fights on %d %s\n\n",
+		monsters[sim_type - 'A'].m_name, depth,
+		sim_boss >= 0 ? " (boss, " : "",
+		sim_boss >= 0 ? ma_names[sim_boss] : "",
+		sim_legend ? (sim_boss >= 0 ? ", legendary)" : " (legendary)")
+			: (sim_boss >= 0 ? ")" : ""),
+		fights, jobs, jobs == 1 ? "core" : "cores");
+	fflush(stdout);
+
+	fds = (int (*)[2]) newmem(jobs * sizeof *fds);
+	for (i = 0; i < jobs; i++) {
+		n = fights / jobs + (i < fights % jobs);
+		if (pipe(fds[i]) < 0 || (pid = fork()) < 0)
+			die("can't start a worker: %s", strerror(errno));
+		if (pid == 0) {
+			close(fds[i][0]);
+			seed += 7919L * (i + 1);
+			setmem(&part, sizeof part, 0);
+			batch(&part, n);
+			if (write(fds[i][1], &part, sizeof part) != sizeof part)
+				_exit(1);
+			_exit(0);
+		}
+		close(fds[i][1]);
+	}
+	setmem(&res, sizeof res, 0);
+	for (i = 0; i < jobs; i++) {
+		if (read(fds[i][0], &part, sizeof part) != sizeof part)
+			die("a worker died%s", "");
+		close(fds[i][0]);
+		sum(&res, &part);
+	}
+	while (wait(NULL) > 0)
+		continue;
+	free(fds);
+	report(&res);
+	return 0;
+}
+
+/*
+ * usage:
+ *	Say how to call it and give up
+ */
+static
+void
+usage(void)
+{
+	fprintf(stderr, "usage: rogue-sim [-c class] [-w weapon] [-e plus] "
+		"[-r rarity] [-p prefix] [-s suffix] [-a]\n"
+		"\t\t [-m monster] [-b affix] [-L] [-d depth] [-x level] "
+		"[-n fights] [-j jobs] [-S seed]\n"
+		"  class: warrior rogue sorcerer\n"
+		"  weapon: a weapon name, \"long sword\"; -e adds to hit and damage\n"
+		"  rarity: common magic rare legendary, rolled by apply_diablo_stats\n"
+		"  prefix, suffix: an affix name or number; -a applies their\n"
+		"\tvalues to the weapon and player (the game doesn't yet)\n"
+		"  monster: its letter; affix: none vampiric thorns teleporter\n"
+		"\t(a boss needs depth 2 or more); -L makes it legendary\n");
+	exit(1);
+}
+
+/*
+ * die:
+ *	Complain and give up
+ */
+static
+void
+die(char *fmt, char *arg)
+{
+	fprintf(stderr, "rogue-sim: ");
+	fprintf(stderr, fmt, arg);
+	fputc('\n', stderr);
+	exit(1);
+}
+
+/*
+ * lookup:
+ *	Find a name in a list, or give up
+ */
+static
+int
+lookup(char *name, char **names, int n)
+{
+	register int i;
+
+	for (i = 0; i < n; i++)
+		if (strcmp(name, names[i]) == 0)
+			return i;
+	die("unknown \"%s\"", name);
+	return 0;
+}
+
+/*
+ * affix:
+ *	Find an affix by name or number
+ */
+static
+int
+affix(char *name, struct Affix *table, int n)
+{
+	register int i;
+
+	if (is_digit(*name) && (i = atoi(name)) < n)
+		return i;
+	for (i = 0; i < n; i++)
+		if (strcmp(name, table[i].name) == 0)
+			return i;
+	die("unknown affix \"%s\"", name);
+	return 0;
+}
+
+/*
+ * loadout:
+ *	Roll up the player as init_player() does and arm him
+ */
+static
+void
+loadout(char *wname, int plus, int rarity, int pre, int suf, bool apply,
+	int xlvl)
+{
+	register THING *obj;
+	register int which;
+
+	init_player();
+	if (xlvl > 1) {
+		pstats.s_exp = e_levels[xlvl - 2];
+		pstats.s_lvl = xlvl;
+		max_hp += roll(xlvl - 1, 10);
+		pstats.s_hpt = max_hp;
+	}
+	if (wname != NULL) {
+		for (which = 0; which < MAXWEAPONS; which++)
+			if (strcmp(wname, w_names[which]) == 0)
+				break;
+		if (which == MAXWEAPONS)
+			die("unknown weapon \"%s\"", wname);
+		obj = game_item();
+		obj->o_type = WEAPON;
+		obj->o_which = which;
+		init_weapon(obj, which);
+		obj->o_flags |= ISKNOW;
+		obj->o_count = 1;
+		obj->o_group = 0;
+		cur_weapon = obj;
+	}
+	if ((obj = cur_weapon) != NULL) {
+		obj->o_hplus += plus;
+		obj->o_dplus += plus;
+		if (rarity >= 0)
+			do
+				apply_diablo_stats(obj, level);
+			while ((int) obj->o_rarity != rarity);
+		if (pre >= 0)
+			obj->o_prefix_id = pre;
+		if (suf >= 0)
+			obj->o_suffix_id = suf;
+		if (apply) {
+			bonus(obj, prefixes, obj->o_prefix_id);
+			bonus(obj, suffixes, obj->o_suffix_id);
+		}
+	}
+	power_reset();
+	sim_player = player;
+}
+
+/*
+ * bonus:
+ *	Give the player what one affix of his weapon is worth
+ */
+static
+void
+bonus(THING *weap, struct Affix *table, int index)
+{
+	register int val;
+
+	if ((val = get_affix_value(table, index)) == 0)
+		return;
+	switch (table[index].type) {
+	when MOD_STR: add_str(&pstats.s_str, val);
+	when MOD_DMG: weap->o_dplus += val;
+	when MOD_HIT: weap->o_hplus += val;
+	when MOD_HP:
+		max_hp += val;
+		pstats.s_hpt = max_hp;
+	otherwise:
+		break;
+	}
+}
+
+/*
+ * spawn:
+ *	Make the monster for the next fight.  new_monster() makes a boss
+ *	when it feels like it, so keep making them until it's the wanted
+ *	kind.
+ */
+static
+void
+spawn(void)
+{
+	for (;;) {
+		mlist = NULL;
+		mt_clear();
+		t_level();
+		setmem(&sim_mon, sizeof sim_mon, 0);
+		new_monster(&sim_mon, sim_type, &sim_pos);
+		if ((sim_mon.t_rarity == RARE) == (sim_boss >= 0))
+			break;
+	}
+	if (sim_boss >= 0)
+		sim_mon.t_affix = sim_boss;
+	if (sim_legend)
+		legendary(&sim_mon);
+	/*
+	 * fight() wakes whatever it hits
+	 */
+	sim_mon.t_flags |= ISRUN;
+}
+
+/*
+ * batch:
+ *	Fight n fights and add up how they went
+ */
+static
+void
+batch(struct simres *rp, long n)
+{
+	register THING *tp = &sim_mon;
+	register int turn, hp;
+	register bool hit;
+
+	while (n-- > 0) {
+		player = sim_player;
+		spawn();
+		rp->r_fights++;
+		for (turn = 1; turn <= SIMTURNS; turn++) {
+			/*
+			 * The player swings, as in fight()
+			 */
+			rp->r_pswing++;
+			hp = tp->t_stats.s_hpt;
+			if ((hit = roll_em(&player, tp, cur_weapon, FALSE))) {
+				rp->r_phit++;
+				bucket(rp->r_pdmg, SIMDMG, hp - tp->t_stats.s_hpt);
+				if (tp->t_affix == MA_THORNS)
+					pstats.s_hpt -= 2;
+			}
+			if (pstats.s_hpt <= 0) {
+				rp->r_lost++;
+				bucket(rp->r_die, SIMTURNS, turn);
+				break;
+			}
+			if (tp->t_stats.s_hpt <= 0) {
+				rp->r_won++;
+				rp->r_hpleft += pstats.s_hpt;
+				bucket(rp->r_kill, SIMTURNS, turn);
+				break;
+			}
+			if (hit && tp->t_affix == MA_TELEPORTER && rnd(100) < 25) {
+				rp->r_fled++;
+				break;
+			}
+			/*
+			 * And the monster, as in attack()
+			 */
+			rp->r_mswing++;
+			hp = pstats.s_hpt;
+			if (roll_em(tp, &player, NULL, FALSE)) {
+				rp->r_mhit++;
+				bucket(rp->r_mdmg, SIMDMG, hp - pstats.s_hpt);
+				if (tp->t_affix == MA_VAMPIRIC) {
+					tp->t_stats.s_hpt += 5;
+					if (tp->t_stats.s_hpt > tp->t_stats.s_maxhp)
+						tp->t_stats.s_hpt = tp->t_stats.s_maxhp;
+				}
+			}
+			if (pstats.s_hpt <= 0) {
+				rp->r_lost++;
+				bucket(rp->r_die, SIMTURNS, turn);
+				break;
+			}
+		}
+	}
+}
+
+/*
+ * sum:
+ *	Add one batch's results to another's
+ */
+static
+void
+sum(struct simres *to, struct simres *from)
+{
+	register int i;
+
+	to->r_fights += from->r_fights;
+	to->r_won += from->r_won;
+	to->r_lost += from->r_lost;
+	to->r_fled += from->r_fled;
+	to->r_pswing += from->r_pswing;
+	to->r_phit += from->r_phit;
+	to->r_mswing += from->r_mswing;
+	to->r_mhit += from->r_mhit;
+	to->r_hpleft += from->r_hpleft;
+	for (i = 0; i <= SIMTURNS; i++) {
+		to->r_kill[i] += from->r_kill[i];
+		to->r_die[i] += from->r_die[i];
+	}
+	for (i = 0; i <= SIMDMG; i++) {
+		to->r_pdmg[i] += from->r_pdmg[i];
+		to->r_mdmg[i] += from->r_mdmg[i];
+	}
+}
+
+/*
+ * bucket:
+ *	Count a value in a histogram
+ */
+static
+void
+bucket(long *hist, int n, int val)
+{
+	hist[max(0, min(val, n))]++;
+}
+
+/*
+ * report:
+ *	Print what the fights came to
+ */
+static
+void
+report(struct simres *rp)
+{
+	long f = rp->r_fights;
+	long stale = f - rp->r_won - rp->r_lost - rp->r_fled;
+
+	printf("won %6.2f%%  lost %6.2f%%  fled %6.2f%%  stalemate %6.2f%%\n",
+		100.0 * rp->r_won / f, 100.0 * rp->r_lost / f,
+		100.0 * rp->r_fled / f, 100.0 * stale / f);
+	printf("player hits %5.1f%% of %ld swings, monster %5.1f%% of %ld\n",
+		rp->r_pswing ? 100.0 * rp->r_phit / rp->r_pswing : 0.0, rp->r_pswing,
+		rp->r_mswing ? 100.0 * rp->r_mhit / rp->r_mswing : 0.0, rp->r_mswing);
+	if (rp->r_won)
+		printf("hit points left after a win: %.1f of %d\n",
+			(double) rp->r_hpleft / rp->r_won, max_hp);
+	histogram("turns to kill", rp->r_kill, SIMTURNS, rp->r_won);
+	histogram("turns to die", rp->r_die, SIMTURNS, rp->r_lost);
+	histogram("damage per player hit", rp->r_pdmg, SIMDMG, rp->r_phit);
+	histogram("damage per monster hit", rp->r_mdmg, SIMDMG, rp->r_mhit);
+}
+
+/*
+ * histogram:
+ *	Print the mean and spread of a histogram, and a bar for each
+ *	value that turned up often enough to see
+ */
+static
+void
+histogram(char *title, long *hist, int n, long total)
+{
+	register int i, w;
+	double mean = 0.0;
+
+	if (total == 0)
+		return;
+	for (i = 0; i <= n; i++)
+		mean += (double) i * hist[i];
+	mean /= total;
+	printf("\n%s: mean %.2f  median %d  90%% %d  max %d%s\n", title, mean,
+		pctile(hist, n, total, 50), pctile(hist, n, total, 90),
+		pctile(hist, n, total, 100), hist[n] ? "+" : "");
+	for (i = 0; i <= n; i++) {
+		if (hist[i] * 200 < total)
+			continue;
+		printf("  %3d%s %6.2f%% ", i, i == n ? "+" : " ", 100.0 * hist[i] / total);
+		for (w = (int) (hist[i] * 50 / total); w > 0; w--)
+			putchar('#');
+		putchar('\n');
+	}
+}
+
+/*
+ * pctile:
+ *	The value under which pct percent of a histogram lies
+ */
+static
+int
+pctile(long *hist, int n, long total, int pct)
+{
+	register int i;
+	long sum = 0;
+
+	for (i = 0; i < n; i++)
+		if ((sum += hist[i]) * 100 >= total * pct)
+			break;
+	return i;
+}
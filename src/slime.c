@@ -7,15 +7,27 @@
 #include	"rogue.h"
 #include	"curses.h"
 
+static coord slimy;
+
 /*
- * Slime_split:
- *	Called when it has been decided that A slime should divide itself
+ * Scratch space for the search of a slime colony: where the slimes
+ * are, which of them have been looked at and the queue still to look
+ * at, which never holds a square twice
  */
+#define SL_BIT(y,x)	((y) * MAXCOLS + (x))
+#define sl_set(m,y,x)	((m)[SL_BIT(y,x) >> 3] |= 1 << (SL_BIT(y,x) & 7))
+#define sl_isset(m,y,x)	((m)[SL_BIT(y,x) >> 3] & (1 << (SL_BIT(y,x) & 7)))
 
-static coord slimy;
+static byte sl_slime[(MAXLINES * MAXCOLS + 7) / 8];
+static byte sl_seen[(MAXLINES * MAXCOLS + 7) / 8];
+static coord sl_queue[MAXLINES * MAXCOLS];
 
 static bool	new_slime(THING *tp);
 
+/*
+ * Slime_split:
+ *	Called when it has been decided that A slime should divide itself
+ */
 void
 slime_split(tp)
 	THING *tp;
@@ -33,39 +45,50 @@ slime_split(tp)
 	start_run(&slimy);
 }
 
+/*
+ * new_slime:
+ *	Find a place for the new slime: next to the one that was hit if
+ *	there's room, else next to the nearest slime joined to it that
+ *	has room.  The colony is searched breadth first.
+ */
 static
 bool
 new_slime(tp)
 	THING *tp;
 {
-	register int y, x, ty, tx;
-	register bool ret;
-	THING *ntp;
-	coord sp;
+	register int i, y, x, head, tail;
+	coord sp, cur;
 
-	ret = FALSE;
-	tp->t_flags |= ISFLY;
-	if (!plop_monster((ty = tp->t_pos.y), (tx = tp->t_pos.x), &sp)) {
+	setmem(sl_slime, sizeof sl_slime, 0);
+	setmem(sl_seen, sizeof sl_seen, 0);
+	for (i = 0; i < mtab.mt_count; i++)
+		if (mtab.mt_thing[i] != NULL && mtab.mt_type[i] == 'S')
+			sl_set(sl_slime, mtab.mt_y[i], mtab.mt_x[i]);
+	head = tail = 0;
+	sl_queue[tail++] = tp->t_pos;
+	sl_set(sl_seen, tp->t_pos.y, tp->t_pos.x);
+	while (head < tail) {
+		cur = sl_queue[head++];
+		if (plop_monster(cur.y, cur.x, &sp)) {
+			slimy = sp;
+			return TRUE;
+		}
 		/*
-		 * There were no open spaces next to this slime, look for other
-		 * slimes that might have open spaces next to them.
+		 * No open spaces next to this slime, so queue up the slimes
+		 * next to it that haven't been looked at
 		 */
-		for (y = ty -1; y <= ty+1; y++)
-			for (x = tx-1; x <= tx+1; x++)
-				if (winat(y, x) == 'S' && (ntp = moat(y, x))) {
-					if (ntp->t_flags & ISFLY)
-						continue;				/* Already done this one */
-					if (new_slime(ntp)) {
-						y = ty+2;
-						x = tx +2;
-					}
-				}
-	} else {
-		ret = TRUE;
-		slimy = sp;
+		for (y = cur.y - 1; y <= cur.y + 1; y++)
+			for (x = cur.x - 1; x <= cur.x + 1; x++) {
+				if (y < 0 || y >= MAXLINES || x < 0 || x >= MAXCOLS)
+					continue;
+				if (!sl_isset(sl_slime, y, x) || sl_isset(sl_seen, y, x))
+					continue;
+				sl_set(sl_seen, y, x);
+				sl_queue[tail].y = y;
+				sl_queue[tail++].x = x;
+			}
 	}
-	tp->t_flags &= ~ISFLY;
-	return ret;
+	return FALSE;
 }
 
 /*@
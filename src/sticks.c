@@ -17,10 +17,10 @@ fix_stick(cur)
 	register THING *cur;
 {
 	if (strcmp(ws_type[cur->o_which], "staff") == 0)
-		cur->o_damage = "2d3";
+		cur->o_dice = dice_id("2d3");
 	else
-		cur->o_damage = "1d1";
-	cur->o_hurldmg = "1d1";
+		cur->o_dice = dice_id("1d1");
+	cur->o_hdice = dice_id("1d1");
 
 	cur->o_charges = 3 + rnd(5);
 	switch (cur->o_which)
@@ -28,7 +28,7 @@ fix_stick(cur)
 	when WS_HIT:
 		cur->o_hplus = 100;
 		cur->o_dplus = 3;
-		cur->o_damage = "1d8";
+		cur->o_dice = dice_id("1d8");
 	when WS_LIGHT:
 		cur->o_charges = 10 + rnd(10);
 		break;
@@ -86,6 +86,7 @@ do_zap()
 		if (!(proom->r_flags & ISGONE))
 		{
 			proom->r_flags &= ~ISDARK;
+			fov_reset();
 			/*
 			 * Light the room and put the player back up
 			 */
@@ -161,6 +162,7 @@ do_zap()
 			{
 				tp->t_flags |= ISCANC;
 				tp->t_flags &= ~(ISINVIS|CANHUH);
+				mt_sync(tp);
 				tp->t_disguise = tp->t_type;
 			}
 			else
@@ -196,8 +198,9 @@ do_zap()
 				if (tp->t_pos.y != y || tp->t_pos.x != x)
 					tp->t_oldch = mvinch(tp->t_pos.y, tp->t_pos.x);
 			}
-			tp->t_dest = &hero;
+			dest_hero(tp);
 			tp->t_flags |= ISRUN;
+			mt_sync(tp);
 		}
 	}
 	when WS_MISSILE:
@@ -206,7 +209,8 @@ do_zap()
 
 		ws_know[WS_MISSILE] = TRUE;
 		bolt.o_type = '*';
-		bolt.o_hurldmg = "1d8";
+		bolt.o_dice = dice_id(NULL);
+		bolt.o_hdice = dice_id("1d8");
 		bolt.o_hplus = 1000;
 		bolt.o_dplus = 1;
 		bolt.o_flags = ISMISL;
@@ -225,12 +229,12 @@ do_zap()
 		{
 			if (rnd(20) == 0)
 			{
-				obj->o_damage = "3d8";
+				obj->o_dice = dice_id("3d8");
 				obj->o_dplus = 9;
 			}
 			else
 			{
-				obj->o_damage = "2d8";
+				obj->o_dice = dice_id("2d8");
 				obj->o_dplus = 4;
 			}
 			fight(&delta, tp->t_type, obj, FALSE);
@@ -259,8 +263,9 @@ do_zap()
 					tp->t_flags &= ~ISHASTE;
 				else
 					tp->t_flags |= ISSLOW;
-				tp->t_turn = TRUE;
 			}
+			sched_del(tp);	/* requeue it at its new pace */
+			mt_sync(tp);
 			delta.y = y;
 			delta.x = x;
 			start_run(&delta);
@@ -311,7 +316,7 @@ drain()
 	inpass = (proom->r_flags & ISGONE);
 	dp = drainee;
 	for (mp = mlist; mp != NULL; mp = next(mp))
-		if (mp->t_room == proom || mp->t_room == corp ||
+		if (ROOM_AT(mp->t_room) == proom || ROOM_AT(mp->t_room) == corp ||
 			(inpass && chat(mp->t_pos.y, mp->t_pos.x) == DOOR &&
 			&passages[flat(mp->t_pos.y, mp->t_pos.x) & F_PNUM] == proom))
 			*dp++ = mp;
@@ -360,7 +365,7 @@ fire_bolt(start, dir, name)
 	is_frost = (strcmp(name, "frost") == 0);
 	bolt.o_type = WEAPON;
 	bolt.o_which = FLAME;
-	bolt.o_damage = bolt.o_hurldmg = "6d6";
+	bolt.o_dice = bolt.o_hdice = dice_id("6d6");
 	bolt.o_hplus = 30;
 	bolt.o_dplus = 0;
 	w_names[FLAME] = name;
@@ -15,9 +15,48 @@
 extern struct Affix prefixes[];
 extern struct Affix suffixes[];
 
-#define NUM_PREFIXES 6  // Must match array size in init.c
-#define NUM_SUFFIXES 6  // Must match array size in init.c
-
+/*
+ * What a name is made from.  Identifying, enchanting, revealing a
+ * curse or a slaying, a stack growing or shrinking and putting
+ * something on or taking it off all change the key, so a slot made
+ * before any of those just doesn't match and is made again.
+ */
+struct namekey {
+	int k_epoch;			/* name_epoch when it was made */
+	shint k_type, k_which, k_count;
+	shint k_hplus, k_dplus;
+	short k_ac, k_flags;		/* only ISKNOW and ISREVEAL */
+	char k_enemy;
+	byte k_prefix, k_suffix;
+	byte k_know;			/* Whether its kind is known */
+	byte k_worn;			/* Index into worn_str[] */
+	byte k_drop, k_terse;
+};
+
+static struct nameslot {
+	struct namekey n_key;
+	char n_name[MAXSTR];
+} *name_slot,			/* One for each THING in the pool, by l_id */
+  name_other;			/* For a THING that is not (a wand's bolt) */
+static int name_nslot;
+
+static int name_epoch = 1;	/* so an empty slot never matches */
+
+static char *worn_str[] = {
+	"",
+	" (being worn)",
+	" (weapon in hand)",
+	" (on head)",
+	" (on hands)",
+	" (on feet)",
+	" (in off hand)",
+	" (on left hand)",
+	" (on right hand)",
+};
+
+static struct nameslot	*name_find(THING *obj);
+static void	name_key(THING *obj, bool drop, struct namekey *kp);
+static void	name_make(THING *obj, char *nbuf);
 static void	chopmsg(char *s, char *shmsg, char *lnmsg, ...);
 static void	print_disc(byte type);
 static void	set_order(short *order, int numthings);
@@ -28,43 +67,170 @@ static char	*nothing(byte type);
  * inv_name:
  *	Return the name of something as it would appear in an
  *	inventory.
+ *
+ *	@ Each object in the pool has its own slot in name_slot[], so
+ *	  its name stays put while another object's is made and is only
+ *	  written again when its key no longer matches.  Things outside
+ *	  the pool all share name_other.
  */
 char *
 inv_name(THING *obj, bool drop)
 {
-	register int which = obj->o_which;
-	register char *pb;
+	register struct nameslot *np;
+	struct namekey key;
 
+	np = name_find(obj);
 	//@ validate array index bounds
-	if (which < 0 || which >= 200) return prbuf;  //@ safe upper bound
+	if (obj->o_which < 0 || obj->o_which >= 200) {  //@ safe upper bound
+		setmem(&np->n_key, sizeof(np->n_key), 0);  //@ so it is made again
+		strcpy(np->n_name, "a strange thing");
+		return np->n_name;
+	}
+
+	name_key(obj, drop, &key);
+	if (memcmp(&np->n_key, &key, sizeof(key)) != 0)
+	{
+		name_make(obj, np->n_name);
+		strncat(np->n_name, worn_str[key.k_worn],
+			MAXSTR - strlen(np->n_name) - 1);
+		if (drop && ismonster(np->n_name[0]))
+			np->n_name[0] = tolower(np->n_name[0]);
+		else if (!drop && is_lower(np->n_name[0]))
+			np->n_name[0] = toupper(np->n_name[0]);
+		np->n_key = key;
+	}
+	return np->n_name;
+}
+
+/*
+ * name_find:
+ *	The slot for the name of obj, making room for its l_id
+ */
+static
+struct nameslot *
+name_find(THING *obj)
+{
+	register int id = obj->l_id;
+	struct nameslot *ns;
+	int n;
+
+	if (!t_inuse(obj))
+		return &name_other;
+	if (id >= name_nslot)
+	{
+		n = max(name_nslot * 2, id + 1);
+		ns = (struct nameslot *) newmem(n * sizeof(struct nameslot));
+		if (name_slot != NULL)
+			memcpy(ns, name_slot, name_nslot * sizeof(struct nameslot));
+		//@ an epoch of 0 never matches, see name_epoch
+		setmem(&ns[name_nslot], (n - name_nslot) * sizeof(struct nameslot), 0);
+		free(name_slot);
+		name_slot = ns;
+		name_nslot = n;
+	}
+	return &name_slot[id];
+}
+
+/*
+ * name_dirty:
+ *	Something a name is made from has changed that the keys can't
+ *	see (a guess was typed in), so make every slot miss once.
+ */
+void
+name_dirty(void)
+{
+	name_epoch++;
+}
 
-	pb = prbuf;
+/*
+ * name_key:
+ *	Everything that goes into the name of obj
+ */
+static
+void
+name_key(THING *obj, bool drop, struct namekey *kp)
+{
+	register int which = obj->o_which;
+
+	setmem(kp, sizeof(struct namekey), 0);
+	kp->k_epoch = name_epoch;
+	kp->k_type = obj->o_type;
+	kp->k_which = which;
+	kp->k_count = obj->o_count;
+	kp->k_hplus = obj->o_hplus;
+	kp->k_dplus = obj->o_dplus;
+	kp->k_ac = obj->o_ac;
+	kp->k_flags = obj->o_flags & (ISKNOW|ISREVEAL);
+	kp->k_enemy = obj->o_enemy;
+	kp->k_prefix = obj->o_prefix_id;
+	kp->k_suffix = obj->o_suffix_id;
+	switch (obj->o_type)
+	{
+	when SCROLL: kp->k_know = s_know[which];
+	when POTION: kp->k_know = p_know[which];
+	when RING: kp->k_know = r_know[which];
+	when STICK: kp->k_know = ws_know[which];
+	}
+	if (obj == cur_armor)
+		kp->k_worn = 1;
+	else if (obj == cur_weapon)
+		kp->k_worn = 2;
+	else if (obj == cur_helmet)
+		kp->k_worn = 3;
+	else if (obj == cur_gloves)
+		kp->k_worn = 4;
+	else if (obj == cur_boots)
+		kp->k_worn = 5;
+	else if (obj == cur_shield)
+		kp->k_worn = 6;
+	else if (obj == cur_ring[LEFT])
+		kp->k_worn = 7;
+	else if (obj == cur_ring[RIGHT])
+		kp->k_worn = 8;
+	kp->k_drop = drop;
+	kp->k_terse = terse || expert;
+}
+
+/*
+ * name_make:
+ *	Write the name of obj into nbuf, without the case fix or how
+ *	it is being worn
+ */
+static
+void
+name_make(THING *obj, char *nbuf)
+{
+	register int which = obj->o_which;
+	register char *pb;
+
+	pb = nbuf;
+	*nbuf = '\0';
 	switch (obj->o_type)
 	{
 	when SCROLL:
 		if (obj->o_count == 1) {
-			strncpy(pb, "A scroll ", 128 - (pb - prbuf) - 1);
-			pb = &prbuf[strlen(prbuf)];
+			strncpy(pb, "A scroll ", 128 - (pb - nbuf) - 1);
+			pb = &nbuf[strlen(nbuf)];
 		} else {
-			snprintf(pb, 128 - (pb - prbuf), "%d scrolls ", obj->o_count);
-			pb = &prbuf[strlen(prbuf)];
+			snprintf(pb, 128 - (pb - nbuf), "%d scrolls ", obj->o_count);
+			pb = &nbuf[strlen(nbuf)];
 		}
 		if (s_know[which])
-			snprintf(pb, 128 - (pb - prbuf), "of %s", s_magic[which].mi_name);
+			snprintf(pb, 128 - (pb - nbuf), "of %s", s_magic[which].mi_name);
 		else if (*s_guess[which])
-			snprintf(pb, 128 - (pb - prbuf), "called %s", s_guess[which]);
+			snprintf(pb, 128 - (pb - nbuf), "called %s", s_guess[which]);
 		else
 			chopmsg(pb, "titled '%.17s'","titled '%s'", &s_names[which]);
 	when POTION:
 		if (obj->o_count == 1)
 		{
-			strncpy(pb, "A potion ", 128 - (pb - prbuf) - 1);
-			pb = &prbuf[strlen(prbuf)];
+			strncpy(pb, "A potion ", 128 - (pb - nbuf) - 1);
+			pb = &nbuf[strlen(nbuf)];
 		}
 		else
 		{
-			snprintf(pb, 128 - (pb - prbuf), "%d potions ", obj->o_count);
-			pb = &prbuf[strlen(prbuf)];
+			snprintf(pb, 128 - (pb - nbuf), "%d potions ", obj->o_count);
+			pb = &nbuf[strlen(nbuf)];
 		}
 		if (p_know[which]) {
 			chopmsg(pb, "of %s", "of %s(%s)",
@@ -75,27 +241,27 @@ inv_name(THING *obj, bool drop)
 				p_colors[which]);
 		}
 		else if (obj->o_count == 1)
-			snprintf(prbuf, 128, "A%s %s potion", vowelstr(p_colors[which]),
+			snprintf(nbuf, 128, "A%s %s potion", vowelstr(p_colors[which]),
 				p_colors[which]);
 		else
-			snprintf(prbuf, 128, "%d %s potions", obj->o_count, p_colors[which]);
+			snprintf(nbuf, 128, "%d %s potions", obj->o_count, p_colors[which]);
 	when FOOD:
 		if (which == 1)
 			if (obj->o_count == 1)
-				snprintf(pb, 128 - (pb - prbuf), "A%s %s", vowelstr(fruit), fruit);
+				snprintf(pb, 128 - (pb - nbuf), "A%s %s", vowelstr(fruit), fruit);
 			else
-				snprintf(pb, 128 - (pb - prbuf), "%d %ss", obj->o_count, fruit);
+				snprintf(pb, 128 - (pb - nbuf), "%d %ss", obj->o_count, fruit);
 		else
 			if (obj->o_count == 1)
-				strncpy(pb, "Some food", 128 - (pb - prbuf) - 1);
+				strncpy(pb, "Some food", 128 - (pb - nbuf) - 1);
 			else
-				snprintf(pb, 128 - (pb - prbuf), "%d rations of food", obj->o_count);
+				snprintf(pb, 128 - (pb - nbuf), "%d rations of food", obj->o_count);
 	when WEAPON:
 		if (obj->o_count > 1)
 			sprintf(pb, "%d ", obj->o_count);
 		else
 			sprintf(pb, "A%s ", vowelstr(w_names[which]));
-		pb = &prbuf[strlen(prbuf)];
+		pb = &nbuf[strlen(nbuf)];
 		if (obj->o_flags & ISKNOW)
 			sprintf(pb, "%s %s", num(obj->o_hplus, obj->o_dplus, WEAPON),
 				w_names[which]);
@@ -145,11 +311,11 @@ inv_name(THING *obj, bool drop)
 		else
 			sprintf(pb, "%s", sh_names[which]);
 	when AMULET:
-		strncpy(pb, "The Amulet of Yendor", 128 - (pb - prbuf) - 1);
+		strncpy(pb, "The Amulet of Yendor", 128 - (pb - nbuf) - 1);
 	when STICK:
 		sprintf(pb, "A%s %s ", vowelstr(ws_type[which]),
 		ws_type[which]);
-		pb = &prbuf[strlen(prbuf)];
+		pb = &nbuf[strlen(nbuf)];
 		if (ws_know[which])
 			chopmsg(pb, "of %s%s", "of %s%s(%s)",
 				ws_magic[which].mi_name,
@@ -158,7 +324,7 @@ inv_name(THING *obj, bool drop)
 			chopmsg(pb, "called %s", "called %s(%s)", ws_guess[which],
 				ws_made[which]);
 		else
-			sprintf(pb = &prbuf[2], "%s %s", ws_made[which], ws_type[which]);
+			sprintf(pb = &nbuf[2], "%s %s", ws_made[which], ws_type[which]);
 	when RING:
 		if (r_know[which])
 			chopmsg(pb, "A%s ring of %s", "A%s ring of %s(%s)", ring_num(obj),
@@ -180,35 +346,14 @@ inv_name(THING *obj, bool drop)
 	}
 	if (obj->o_prefix_id > 0 && obj->o_prefix_id < NUM_PREFIXES) {
 		char temp[128];
-		strncpy(temp, prbuf, sizeof(temp) - 1);
+		strncpy(temp, nbuf, sizeof(temp) - 1);
 		temp[sizeof(temp) - 1] = '\0';
-		snprintf(prbuf, 128, "%s %s", prefixes[obj->o_prefix_id].name, temp);
+		snprintf(nbuf, 128, "%s %s", prefixes[obj->o_prefix_id].name, temp);
 	}
 	if (obj->o_suffix_id > 0 && obj->o_suffix_id < NUM_SUFFIXES) {
-		strncat(prbuf, " ", 128 - strlen(prbuf) - 1);
-		strncat(prbuf, suffixes[obj->o_suffix_id].name, 128 - strlen(prbuf) - 1);
+		strncat(nbuf, " ", 128 - strlen(nbuf) - 1);
+		strncat(nbuf, suffixes[obj->o_suffix_id].name, 128 - strlen(nbuf) - 1);
 	}
-	if (obj == cur_armor)
-		strcat(pb, " (being worn)");
-	if (obj == cur_weapon)
-		strcat(pb, " (weapon in hand)");
-	if (obj == cur_helmet)
-		strcat(pb, " (on head)");
-	if (obj == cur_gloves)
-		strcat(pb, " (on hands)");
-	if (obj == cur_boots)
-		strcat(pb, " (on feet)");
-	if (obj == cur_shield)
-		strcat(pb, " (in off hand)");
-	if (obj == cur_ring[LEFT])
-		strcat(pb, " (on left hand)");
-	else if (obj == cur_ring[RIGHT])
-		strcat(pb, " (on right hand)");
-	if (drop && ismonster(prbuf[0]))
-		prbuf[0] = tolower(prbuf[0]);
-	else if (!drop && is_lower(*prbuf))
-		*prbuf = toupper(*prbuf);
-	return prbuf;
 }
 
 //@ changed original signature to use varargs
@@ -254,7 +399,7 @@ drop(void)
 			return;
 		}
 		op->o_count--;
-		bcopy(*nobj,*op);
+		t_copy(nobj, op);
 		nobj->o_count = 1;
 		op = nobj;
 		if (op->o_group != 0)
@@ -266,6 +411,7 @@ drop(void)
 	/*
 	 * Link it into the level object list
 	 */
+	op = t_demote(op);
 	attach(lvl_obj, op);
 	chat(hero.y, hero.x) = op->o_type;
 	bcopy(op->o_pos,hero);
@@ -378,7 +524,7 @@ new_thing(void)
 		return NULL;
 	memset(cur, 0, sizeof(THING));  /* Zero all fields to prevent uninitialized memory bugs */
 	cur->o_hplus = cur->o_dplus = 0;
-	cur->o_damage = cur->o_hurldmg = "0d0";
+	cur->o_dice = cur->o_hdice = dice_id("0d0");
 	cur->o_ac = 11;
 	cur->o_count = 1;
 	cur->o_group = 0;
@@ -67,7 +67,7 @@ missile(int ydelta, int xdelta)
 		obj->o_count--;
 		if (obj->o_group == 0)
 			inpack--;
-		bcopy(*nitem,*obj);
+		t_copy(nitem, obj);
 		nitem->o_count = 1;
 		obj = nitem;
 	}
@@ -171,6 +171,7 @@ fall(THING *obj, bool pr)
 			if (moat(fpos.y,fpos.x) != NULL)
 				moat(fpos.y,fpos.x)->t_oldch = obj->o_type;
 		}
+		obj = t_demote(obj);
 		attach(lvl_obj, obj);
 		return;
 	case 2:
@@ -193,8 +194,8 @@ init_weapon(THING *weap, byte type)
 	register struct init_weps *iwp;
 
 	iwp = &init_dam[type];
-	weap->o_damage = iwp->iw_dam;
-	weap->o_hurldmg = iwp->iw_hrl;
+	weap->o_dice = dice_id(iwp->iw_dam);
+	weap->o_hdice = dice_id(iwp->iw_hrl);
 	weap->o_launch = iwp->iw_launch;
 	weap->o_flags = iwp->iw_flags;
 	if (weap->o_flags & ISMANY)
@@ -275,6 +276,7 @@ bad:
 
 	sp = inv_name(obj, TRUE);
 	cur_weapon = obj;
+	power_reset();
 	ifterse2("now wielding %s (%c)", "you are now wielding %s (%c)",
 		sp, pack_char(obj));
 }
@@ -337,6 +339,6 @@ tick_pause(void)
 		md_clock();
 #endif
 */
-	cur_refresh();
+	show_frame(TRUE);
 	msleep(55);
 }
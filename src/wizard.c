@@ -77,7 +77,7 @@ create_obj(void)
 	THING *obj;
 	byte ch, bless;
 
-	if ((obj = new_item()) == NULL)
+	if ((obj = game_item()) == NULL)
 	{
 		msg("can't create anything now");
 		return;
@@ -99,7 +99,7 @@ create_obj(void)
 	obj->o_which = (is_digit((ch = readchar())) ? ch - '0' : ch - 'a' + 10);
 	obj->o_group = 0;
 	obj->o_count = 1;
-	obj->o_damage = obj->o_hurldmg = "0d0";
+	obj->o_dice = obj->o_hdice = dice_id("0d0");
 	mpos = 0;
 	if (obj->o_type == WEAPON || obj->o_type == ARMOR)
 	{
@@ -174,11 +174,13 @@ teleport(void)
 	{
 		leave_room(&hero);
 		bcopy(hero,c);
+		fov_reset();
 		enter_room(&hero);
 	}
 	else
 	{
 		bcopy(hero,c);
+		fov_reset();
 		look(TRUE);
 	}
 	mvaddch(hero.y, hero.x, PLAYER);